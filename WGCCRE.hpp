@@ -1,9 +1,76 @@
 #ifndef LOUIERIKSSON_WGCCRE_HPP
 #define LOUIERIKSSON_WGCCRE_HPP
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <optional>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/*
+ * Batched trigonometry selects between AVX2 and AVX-512 kernels at runtime on x86-64 GCC and Clang. Define
+ * LOUIERIKSSON_WGCCRE_NO_DISPATCH to use only the instruction sets enabled at compile time.
+ */
+#if !defined(LOUIERIKSSON_WGCCRE_NO_DISPATCH) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LOUIERIKSSON_WGCCRE_DISPATCH
+#define LOUIERIKSSON_WGCCRE_INLINE [[gnu::always_inline]]
+#else
+#define LOUIERIKSSON_WGCCRE_INLINE
+#endif
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ * The reports supplying each body's model, in order of preference. Define LOUIERIKSSON_WGCCRE_REPORTS to pin other
+ * model versions for every function, e.g. "Report_2009, Report_2015".
+ */
+#if !defined(LOUIERIKSSON_WGCCRE_REPORTS)
+#define LOUIERIKSSON_WGCCRE_REPORTS Report_2015, Report_2009
+#endif
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+#include <atomic>
+#include <chrono>
+#endif
+
+/*
+ * Streams of orientations may also be generated by C++20 coroutines where the compiler supports them.
+ */
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <exception>
+#define LOUIERIKSSON_WGCCRE_COROUTINES
+#endif
+
+#if defined(LOUIERIKSSON_WGCCRE_OPENCL)
+#if defined(__APPLE__)
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+#endif
 
 namespace LouiEriksson {
 	
@@ -22,273 +89,6871 @@ namespace LouiEriksson {
 	 * @see <a href="https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2009reprint.pdf">WGCCRE2009</a>
 	 */
 	struct WGCCRE final {
-	
-	private:
 		
 		/**
-		 * @brief Calculates the sine of an angle in degrees.
-		 *
-		 * @param[in] _x The input angle in degrees.
-		 * @return The sine value of the input angle in degrees.
+		 * @brief Identifies the astronomical bodies for which orientations are provided.
 		 */
-		template <typename T>
-		static constexpr T sin_d(const T& _x) {
-			
-			constexpr T D2R = (static_cast<T>(M_PI ) / static_cast<T>(180.0));
-			constexpr T R2D = (static_cast<T>(180.0) / static_cast<T>(M_PI ));
-			
-			return std::sin(std::fmod(_x, static_cast<T>(360.0)) * D2R) * R2D;
-		}
+		enum class Body : std::uint8_t {
+			Sol,
+			Mercury,
+			Venus,
+			Earth,
+			Moon,
+			Mars,
+			Jupiter,
+			Saturn,
+			Uranus,
+			Neptune,
+			Phobos,
+			Deimos,
+			Io,
+			Europa,
+			Ganymede,
+			Callisto,
+			Mimas,
+			Enceladus,
+			Tethys,
+			Dione,
+			Rhea,
+			Titan
+		};
+		
+		/** @brief Number of bodies in Body. */
+		static constexpr std::size_t s_BodyCount = static_cast<std::size_t>(Body::Titan) + 1U;
 		
 		/**
-		 * @brief Calculates the cosine of an angle in degrees.
-		 *
-		 * @param[in] _x The input angle in degrees.
-		 * @return The cosine value of the input angle in degrees.
+		 * @brief Identifies a component of an orientation.
 		 */
-		template <typename T>
-		static constexpr T cos_d(const T& _x) {
-			
-			constexpr T D2R = (static_cast<T>(M_PI ) / static_cast<T>(180.0));
-			constexpr T R2D = (static_cast<T>(180.0) / static_cast<T>(M_PI ));
-			
-			return std::cos(std::fmod(_x, static_cast<T>(360.0)) * D2R) * R2D;
+		enum class Component : std::uint8_t {
+			Alpha, /**< @brief Right ascension of the north pole. */
+			Delta, /**< @brief Declination of the north pole. */
+			W      /**< @brief Location of the prime meridian. */
+		};
+		
+		/**
+		 * @brief A set of components to evaluate.
+		 */
+		enum class Components : std::uint8_t {
+			None  = 0U,
+			Alpha = 1U << static_cast<std::uint8_t>(Component::Alpha),
+			Delta = 1U << static_cast<std::uint8_t>(Component::Delta),
+			W     = 1U << static_cast<std::uint8_t>(Component::W),
+			Pole  = Alpha | Delta, /**< @brief The direction of the north pole. */
+			All   = Alpha | Delta | W
+		};
+		
+		friend constexpr Components operator|(const Components& _a, const Components& _b) {
+			return static_cast<Components>(static_cast<std::uint8_t>(_a) | static_cast<std::uint8_t>(_b));
 		}
-
+		
+		/**
+		 * @brief Tiers of evaluation precision, in increasing order of accuracy and cost.
+		 */
+		enum class Precision : std::uint8_t {
+			Float,    /**< @brief Single precision. */
+			Double,   /**< @brief Double precision. */
+			Split,    /**< @brief Double precision with a split epoch. */
+			Extended, /**< @brief long double with a split epoch. */
+			Quadruple /**< @brief __float128 with a split epoch, where the compiler supports it (GNU dialects only). */
+		};
+		
+		/**
+		 * @brief Instruction sets the batched trigonometry may run on.
+		 */
+		enum class InstructionSet : std::uint8_t {
+			Scalar, /**< @brief No vector instructions. */
+			SSE2,   /**< @brief SSE2, with SSE4.1 and FMA if enabled at compile time. */
+			AVX,    /**< @brief AVX, with FMA if enabled at compile time. */
+			NEON,   /**< @brief AArch64 NEON. */
+			AVX2,   /**< @brief AVX2 and FMA, selected at runtime. */
+			AVX512  /**< @brief AVX-512 F and DQ, selected at runtime. */
+		};
+		
+		/**
+		 * @brief Identifies the trigonometric function applied to a periodic term.
+		 */
+		enum class Trig : std::uint8_t {
+			Sin,
+			Cos
+		};
+		
+		/**
+		 * @brief Methods of interpolating between the samples of a LookupTable.
+		 */
+		enum class Interpolation : std::uint8_t {
+			Linear, /**< @brief Linear between neighbouring samples. */
+			Cubic   /**< @brief Cubic Hermite, using the rates sampled alongside each value. */
+		};
+		
+		/**
+		 * @brief A polynomial in the epoch, of the form c0 + (t * _t) + (d * days) + (d2 * days^2).
+		 */
 		template<typename T>
-		static constexpr std::array<T, 3U> ToVSOP87(const std::array<T, 3U>& _alpha_delta_W) {
+		struct Polynomial final {
 			
-			const auto ra = _alpha_delta_W[0];
-			const auto de = _alpha_delta_W[1];
+			T c0, t, d, d2;
 			
-			const auto correction = _alpha_delta_W[2];
+			/**
+			 * @brief Returns the linear coefficient, with the daily rate folded into the units of the epoch.
+			 */
+			constexpr T Rate() const {
+				return t + (d * static_cast<T>(365250.0));
+			}
 			
-			// Values courtesy of stellarium: https://github.com/Stellarium/stellarium/blob/e57820ca6122fe4353d4d66dfa1104bd60e4deb5/src/core/StelCore.cpp#L59
-			const auto x_offset = 90.0 - EarthAxialTilt<T>();
-			const auto y_offset = 0.0000275;
+			/**
+			 * @brief Returns the quadratic coefficient, with the daily rate folded into the units of the epoch.
+			 */
+			constexpr T Acceleration() const {
+				return d2 * static_cast<T>(365250.0L * 365250.0L);
+			}
 			
-			return {
-				std::fmod(de + x_offset, 360.0),
-				std::fmod((ra + correction) - 180.0 + y_offset, 360.0),
-				0
-			};
-		}
+			/**
+			 * @brief Evaluates the polynomial.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The value of the polynomial at the epoch.
+			 */
+			constexpr T Evaluate(const T& _t) const {
+				return c0 + (_t * (Rate() + (_t * Acceleration())));
+			}
+			
+			/**
+			 * @brief Evaluates the derivative of the polynomial with respect to the epoch.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The rate of change of the polynomial at the epoch, per unit of the epoch.
+			 */
+			constexpr T Derivative(const T& _t) const {
+				return Rate() + (static_cast<T>(2.0) * Acceleration() * _t);
+			}
+		};
 		
-	public:
+		/**
+		 * @brief A periodic term, adding amplitude * function(argument) to one component.
+		 */
+		template<typename T>
+		struct Term final {
+			
+			Component    component;
+			Trig         function;
+			std::uint8_t argument;
+			T            amplitude;
+		};
 		
-		template <typename T>
-		static constexpr T EarthAxialTilt() {
-			return 23.4392803055555555556;
-		}
+		/**
+		 * @brief The rotational model of a body.
+		 *
+		 * @details Each component is a polynomial in the epoch plus the sum of its periodic terms. The arguments of the
+		 * periodic terms are evaluated once and may be shared between terms and components.
+		 *
+		 * @tparam A Number of arguments.
+		 * @tparam N Number of periodic terms.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		struct Model final {
+			
+			std::array<Polynomial<T>, 3U> base;
+			std::array<Polynomial<T>,  A> arguments;
+			std::array<Term<T>,        N> terms;
+		};
 		
+		/**
+		 * @brief The orientations of every Body at one epoch.
+		 */
 		template<typename T>
-		static constexpr std::array<T, 3U> GetOrientationVSOP87(const std::string_view& _name, const T& _t) {
+		struct Orientations final {
 			
-			std::array<T, 3U> result;
-			
-			     if (_name == "Sol"    ) { result = Report_2015::Sol    <T, Q>(_t); }
-			else if (_name == "Mercury") { result = Report_2015::Mercury<T, Q>(_t); }
-			else if (_name == "Venus"  ) { result = Report_2015::Venus  <T, Q>(_t); }
-			else if (_name == "Earth"  ) { result = Report_2009::Earth  <T, Q>(_t); }
-			else if (_name == "Moon"   ) { result = Report_2009::Moon   <T, Q>(_t); }
-			else if (_name == "Mars"   ) { result = Report_2015::Mars   <T, Q>(_t); }
-			else if (_name == "Jupiter") { result = Report_2015::Jupiter<T, Q>(_t); }
-			else if (_name == "Saturn" ) { result = Report_2015::Saturn <T, Q>(_t); }
-			else if (_name == "Uranus" ) { result = Report_2015::Uranus <T, Q>(_t); }
-			else if (_name == "Neptune") { result = Report_2015::Neptune<T, Q>(_t); }
-			else {
-				std::cerr << "Not implemented!" << std::endl;
+			/** @brief Orientations as alpha, delta and W (degrees), indexed by the underlying value of each Body. */
+			std::array<std::array<T, 3U>, s_BodyCount> values;
+			
+			constexpr const std::array<T, 3U>& operator[](const Body& _body) const {
+				return values[static_cast<std::size_t>(_body)];
 			}
 			
-			return ToVSOP87(result);
-		}
+			constexpr std::array<T, 3U>& operator[](const Body& _body) {
+				return values[static_cast<std::size_t>(_body)];
+			}
+		};
 		
 		/**
-		 * @brief Provides orientations of astronomical objects as outlined in the 2015 WGCCRE report.
+		 * @brief A view of the orientations of a set of bodies over consecutive epochs, as yielded by a Stream.
 		 *
-		 * @see https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2015reprint.pdf
+		 * @details The storage viewed belongs to the Stream or generator yielding the batch, and is overwritten by the
+		 * next batch.
 		 */
-		struct Report_2015 final {
+		template<typename T>
+		struct Batch final {
+			
+			/** @brief Index of the first epoch of the batch within the whole range. */
+			std::size_t offset;
+			
+			/** @brief Number of epochs in the batch. */
+			std::size_t count;
+			
+			/** @brief Pointer to the \p count epochs of the batch. */
+			const T* t;
+			
+			/**
+			 * @brief Pointers to \p count values each of alpha, delta and W (degrees), indexed by the underlying value of
+			 * each Body. Bodies outside of the set have null pointers.
+			 */
+			std::array<std::array<const T*, 3U>, s_BodyCount> values;
+			
+			constexpr const std::array<const T*, 3U>& operator[](const Body& _body) const {
+				return values[static_cast<std::size_t>(_body)];
+			}
+		};
 		
-			template<typename T>
-			static constexpr std::array<T, 3U> Sol(const double& _t) {
+		/**
+		 * @brief An orientation together with its rate of change.
+		 */
+		template<typename T>
+		struct State final {
+			
+			/** @brief The orientation as alpha, delta and W (degrees). */
+			std::array<T, 3U> value;
+			
+			/** @brief The rates of change of alpha, delta and W, in degrees per unit of the epoch (Julian millennia). */
+			std::array<T, 3U> rate;
+		};
 		
-				const T d = _t * 365250.0;
-				
-				return {
-					286.13,
-					 63.87,
-					84.176 + (14.1844000 * d)
-				};
+		/**
+		 * @brief An epoch held in two parts, as days since J2000.0 plus a (small) fraction of a day.
+		 *
+		 * @details The parts are never added before being multiplied by a daily rate, so no precision is lost to the size
+		 * of the epoch. \p days is typically integral, and \p fraction typically within a day.
+		 */
+		template<typename T>
+		struct SplitEpoch final {
+			
+			T days, fraction;
+			
+			/**
+			 * @brief Creates a split epoch from a two-part Julian date, such as (2460000.5, 0.25).
+			 *
+			 * @param[in] _jd1 The first part of the Julian date, ideally a whole number plus one half.
+			 * @param[in] _jd2 The second part of the Julian date.
+			 * @return The epoch.
+			 */
+			static constexpr SplitEpoch FromJulianDate(const T& _jd1, const T& _jd2) {
+				return { _jd1 - static_cast<T>(2451545.0), _jd2 };
 			}
+		};
 		
+		/**
+		 * @brief Customisation point for writing an orientation directly into a caller-owned type.
+		 *
+		 * @details The primary template assigns the three components through <tt>operator[]</tt>, which suits std::array,
+		 * C arrays and most vector types. Specialise it for types without one, or to convert on the way out:
+		 * @code
+		 * template<>
+		 * struct LouiEriksson::WGCCRE::Output<Vec3> {
+		 *
+		 *     template<typename T>
+		 *     static constexpr void Write(Vec3& _out, const T& _x, const T& _y, const T& _z) {
+		 *         _out.x = _x; _out.y = _y; _out.z = _z;
+		 *     }
+		 * };
+		 * @endcode
+		 *
+		 * @tparam R The output type.
+		 */
+		template<typename R, typename = void>
+		struct Output final {
+			
+			/**
+			 * @brief Writes the three components of an orientation.
+			 *
+			 * @param[out] _out The destination.
+			 * @param[in] _x The first component, e.g. alpha.
+			 * @param[in] _y The second component, e.g. delta.
+			 * @param[in] _z The third component, e.g. W.
+			 */
 			template<typename T>
-			static constexpr std::array<T, 3U> Mercury(const double& _t) {
-				
-				const T d = _t * 365250.0;
-				
-				const T M1 = 174.7910857 + ( 4.092335 * d),
-				        M2 = 349.5821714 + ( 8.184670 * d),
-				        M3 = 164.3732571 + (12.277005 * d),
-				        M4 = 339.1643429 + (16.369340 * d),
-				        M5 = 153.9554286 + (20.461675 * d);
-				
-				return {
-					281.0103 - (0.0328 * _t),
-					 61.4155 - (0.0049 * _t),
-					329.5988 + (6.1385108 * d)     // (± 0.0037)
-						+ 0.01067257 * sin_d(M1)
-						- 0.00112309 * sin_d(M2)
-						- 0.00011040 * sin_d(M3)
-						- 0.00002539 * sin_d(M4)
-						- 0.00000571 * sin_d(M5)
-				};
+			static constexpr void Write(R& _out, const T& _x, const T& _y, const T& _z) {
+				_out[0] = _x;
+				_out[1] = _y;
+				_out[2] = _z;
+			}
+		};
+		
+		struct Report_2015;
+		struct Report_2009;
+		
+		/**
+		 * @brief A policy selecting each body's model from the first of a list of reports which defines it.
+		 *
+		 * @details Selection happens entirely at compile time, so evaluating a body through a policy is a direct reference
+		 * to one report's model. Any type providing the same two functions may be listed, including other policies, which
+		 * allows a single body to be pinned with Pin ahead of a broader list.
+		 *
+		 * @code
+		 * // Mars from the 2009 report, everything else as by default.
+		 * using Reports2009Mars = WGCCRE::Reports<WGCCRE::Pin<WGCCRE::Body::Mars, WGCCRE::Report_2009>, WGCCRE::DefaultReports>;
+		 * @endcode
+		 *
+		 * @tparam R The reports, in order of preference.
+		 */
+		template<typename... R>
+		struct Reports final {
+			
+			/**
+			 * @brief Returns whether any of the reports defines a model of a body.
+			 *
+			 * @tparam B The body.
+			 */
+			template<Body B>
+			static constexpr bool Provides() {
+				return (R::template Provides<B>() || ...);
 			}
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Venus(const double& _t) {
+			/**
+			 * @brief Returns the model of a body from the first report which defines it.
+			 *
+			 * @tparam B The body, which must satisfy Provides().
+			 * @return A reference to the model.
+			 */
+			template<Body B, typename T>
+			static constexpr const auto& GetModel() {
 				
-				const T d = _t * 365250.0;
+				static_assert(Provides<B>(), "None of the reports define a model of this body.");
 				
-				return {
-					272.76,
-					 67.16,
-					160.20 - (1.4813688 * d)
-				};
+				return Find<B, T, R...>();
 			}
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Mars(const double& _t) {
-				
-				const T d = _t * 365250.0;
+		private:
+			
+			template<Body B, typename T, typename First, typename... Rest>
+			static constexpr const auto& Find() {
 				
-				return {
-					317.269202 - (0.10927547 * _t)
-						+ (0.000068 * sin_d(198.991226 + (19139.4819985 * _t)))
-						+ (0.000238 * sin_d(226.292679 + (38280.8511281 * _t)))
-						+ (0.000052 * sin_d(249.663391 + (57420.7251593 * _t)))
-						+ (0.000009 * sin_d(266.183510 + (76560.6367950 * _t)))
-						+ (0.419057 * sin_d( 79.398797 + (    0.5042615 * _t))),
-					54.432516 - (0.05827105 * _t)
-						+ (0.000051 * cos_d(122.433576 + (19139.9407476 * _t)))
-						+ (0.000141 * cos_d( 43.058401 + (38280.8753272 * _t)))
-						+ (0.000031 * cos_d( 57.663379 + (57420.7517205 * _t)))
-						+ (0.000005 * cos_d( 79.476401 + (76560.6495004 * _t)))
-						+ (1.591274 * cos_d(166.325722 + (    0.5042615 * _t))),
-					176.049863 + (350.891982443297 * d)
-						+ (0.000145 * sin_d(129.071773 + (19140.0328244 * _t)))
-						+ (0.000157 * sin_d( 36.352167 + (38281.0473591 * _t)))
-						+ (0.000040 * sin_d( 56.668646 + (57420.9295360 * _t)))
-						+ (0.000001 * sin_d( 67.364003 + (76560.2552215 * _t)))
-						+ (0.000001 * sin_d(104.792680 + (95700.4387578 * _t)))
-						+ (0.584542 * sin_d( 95.391654 + (    0.5042615 * _t)))
-				};
+				if constexpr (First::template Provides<B>()) {
+					return First::template GetModel<B, T>();
+				}
+				else {
+					return Find<B, T, Rest...>();
+				}
 			}
+		};
+		
+		/**
+		 * @brief A policy providing only one body from a report, for use within Reports.
+		 *
+		 * @tparam P The body.
+		 * @tparam R The report.
+		 */
+		template<Body P, typename R>
+		struct Pin final {
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Jupiter(const double& _t) {
+			template<Body B>
+			static constexpr bool Provides() {
+				
+				if constexpr (B == P) {
+					return R::template Provides<B>();
+				}
+				else {
+					return false;
+				}
+			}
 			
-				const T d = _t * 365250.0;
+			template<Body B, typename T>
+			static constexpr const auto& GetModel() {
 				
-				const T Ja =  99.360714 + (4850.4046 * _t), Jb = 175.895369 + (1191.9605 * _t),
-				        Jc = 300.323162 + ( 262.5475 * _t), Jd = 114.012305 + (6070.2476 * _t),
-				        Je =  49.511251 + (  64.3000 * _t);
+				static_assert(B == P, "The body has not been pinned.");
 				
-				return {
-					268.056595 - (0.006499 * _t) + (0.000117 * sin_d(Ja)) + (0.000938 * sin_d(Jb))
-						+ (0.001432 * sin_d(Jc)) + (0.000030 * sin_d(Jd)) + (0.002150 * sin_d(Je)),
-					64.495303 + (0.002413 * _t)  + (0.000050 * cos_d(Ja)) + (0.000404 * cos_d(Jb))
-						+ (0.000617 * cos_d(Jc)) - (0.000013 * cos_d(Jd)) + (0.000926 * cos_d(Je)),
-					284.95 + (870.5360000 * d)
-				};
+				return R::template GetModel<B, T>();
 			}
+		};
+		
+		/**
+		 * @brief The policy used by every function selecting a body's model, set by LOUIERIKSSON_WGCCRE_REPORTS.
+		 *
+		 * @details By default, the 2015 report is preferred and the 2009 report supplies the bodies it lacks.
+		 */
+		using DefaultReports = Reports<LOUIERIKSSON_WGCCRE_REPORTS>;
+	
+	private:
+		
+		/** @brief Names of each Body, indexed by its underlying value. */
+		static constexpr std::array<std::string_view, s_BodyCount> s_BodyNames {
+			"Sol",
+			"Mercury",
+			"Venus",
+			"Earth",
+			"Moon",
+			"Mars",
+			"Jupiter",
+			"Saturn",
+			"Uranus",
+			"Neptune",
+			"Phobos",
+			"Deimos",
+			"Io",
+			"Europa",
+			"Ganymede",
+			"Callisto",
+			"Mimas",
+			"Enceladus",
+			"Tethys",
+			"Dione",
+			"Rhea",
+			"Titan"
+		};
+		
+		/**
+		 * @brief Determines whether the calling function is being evaluated at compile time.
+		 *
+		 * @return True during constant evaluation. Always false on compilers providing no means of detecting it, in which
+		 * case the vectorised paths cannot be constant-evaluated.
+		 */
+		static constexpr bool is_constant_evaluated() {
+#if defined(__cpp_lib_is_constant_evaluated)
+			return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+			return __builtin_is_constant_evaluated();
+#else
+			return false;
+#endif
+		}
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+		
+		/**
+		 * @brief Process-wide instrumentation counters, updated with relaxed atomics.
+		 */
+		struct Counters final {
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Saturn(const double& _t) {
+			std::array<std::atomic<std::uint64_t>, s_BodyCount> evaluations;
+			std::array<std::atomic<std::uint64_t>, s_BodyCount> batches;
+			std::array<std::atomic<std::uint64_t>, s_BodyCount> batch_epochs;
+			std::array<std::atomic<std::uint64_t>, s_BodyCount> batch_nanoseconds;
+			
+			std::atomic<std::uint64_t> cache_hits;
+			std::atomic<std::uint64_t> cache_misses;
+			
+			std::atomic<std::uint64_t> chebyshev_hits;
+			std::atomic<std::uint64_t> chebyshev_misses;
+		};
 		
-				const T d = _t * 365250.0;
-				
-				return {
-					40.589 - (0.036 * _t),
-					83.537 - (0.004 * _t),
-					38.90  + (810.7939024 * d)
-				};
-			}
+		static Counters& GetCounters() {
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Uranus(const double& _t) {
+			static Counters s_Counters{};
+			
+			return s_Counters;
+		}
+#endif
 		
-				const T d = _t * 365250.0;
-				
-				return {
-					257.311,
-					-15.175,
-					203.81 - (501.1600928 * d)
-				};
+		/**
+		 * @brief Adds to an instrumentation counter. Compiles to nothing unless LOUIERIKSSON_WGCCRE_STATS is defined.
+		 *
+		 * @param[in] _select Callable returning the counter to add to, given the Counters.
+		 * @param[in] _value The amount to add.
+		 */
+		template<typename F>
+		static constexpr void Count(F&& _select, const std::uint64_t& _value = 1U) {
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+			if (!is_constant_evaluated()) {
+				_select(GetCounters()).fetch_add(_value, std::memory_order_relaxed);
 			}
+#else
+			static_cast<void>(_select);
+			static_cast<void>(_value);
+#endif
+		}
+		
+		/**
+		 * @brief Records single-epoch evaluations of a body.
+		 */
+		static constexpr void CountEvaluation(const Body& _body, const std::uint64_t& _count = 1U) {
+			Count([&](auto& _c) -> auto& { return _c.evaluations[static_cast<std::size_t>(_body)]; }, _count);
+		}
+		
+		/**
+		 * @brief Records the number of epochs and the time taken by a batched evaluation of a body, over its lifetime.
+		 */
+		class BatchScope final {
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+			std::size_t m_Body;
+			std::uint64_t m_Count;
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Neptune(const double& _t) {
+			std::chrono::steady_clock::time_point m_Begin;
 		
-				const T d = _t * 365250.0;
+		public:
+			
+			BatchScope(const Body& _body, const std::size_t& _count) :
+				m_Body(static_cast<std::size_t>(_body)),
+				m_Count(_count),
+				m_Begin(std::chrono::steady_clock::now()) {}
+			
+			~BatchScope() {
 				
-				const T N = 357.85 + (52.316 * _t);
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Begin);
 				
-				return {
-					299.36  + (0.70 * sin_d(N)),
-					 43.46  - (0.51 * cos_d(N)),
-					249.978 + (541.1397757 * d) - (0.48 * sin_d(N)),
-				};
+				auto& counters = GetCounters();
+				
+				counters.batches          [m_Body].fetch_add(1U,                                          std::memory_order_relaxed);
+				counters.batch_epochs     [m_Body].fetch_add(m_Count,                                     std::memory_order_relaxed);
+				counters.batch_nanoseconds[m_Body].fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
 			}
 			
+			BatchScope(const BatchScope&) = delete;
+			BatchScope& operator=(const BatchScope&) = delete;
+#else
+		public:
+			
+			constexpr BatchScope(const Body&, const std::size_t&) {}
+#endif
 		};
 		
 		/**
-		 * @brief Provides orientations of astronomical objects as outlined in the 2009 WGCCRE report.
+		 * @brief The magnitude below which a quotient may be truncated through std::int64_t.
+		 */
+		template<typename T>
+		static constexpr T s_TruncationLimit = static_cast<T>(std::uint64_t(1U) << 62U);
+		
+		/**
+		 * @brief Calculates the floating-point remainder of _x divided by a positive _y by binary long division.
 		 *
-		 * @see https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2009reprint.pdf
+		 * @details Every subtraction is exact, so the result equals std::fmod(_x, _y) at any magnitude, at the cost of one
+		 * step per binary order of magnitude between the two. Used where a quotient is too large to truncate through an
+		 * integer.
+		 *
+		 * @param[in] _x The dividend.
+		 * @param[in] _y The divisor, greater than zero.
+		 * @return The remainder, with the sign of \p _x, or NaN if \p _x is not finite.
 		 */
-		struct Report_2009 final {
+		template<typename T>
+		static constexpr T fmod_exact(const T& _x, const T& _y) {
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Earth(const double& _t) {
-				
-				const T d = _t * 365250.0;
-				
-				return {
-					  0.00  - (0.641 * _t),
-					 90.00  - (0.557 * _t),
-					190.147 + (360.9856235 * d)
-				};
+			if (_x - _x != static_cast<T>(0.0)) {
+				return _x - _x;
 			}
 			
-			template<typename T>
-			static constexpr std::array<T, 3U> Moon(const double& _t) {
-				
-				const T d = _t * 365250.0;
+			T remainder = _x < static_cast<T>(0.0) ? -_x : _x;
+			T divisor   = _y;
+			
+			while (divisor <= remainder / static_cast<T>(2.0)) {
+				divisor *= static_cast<T>(2.0);
+			}
+			
+			while (divisor >= _y) {
 				
-				const T E1  = 125.045 - ( 0.0529921 * d), E2  = 250.089 - (0.1059842 * d), E3  = 260.008 + (13.0120009 * d),
-				        E4  = 176.625 + (13.3407154 * d), E5  = 357.529 + (0.9856003 * d), E6  = 311.589 + (26.4057084 * d),
-				        E7  = 134.963 + (13.0649930 * d), E8  = 276.617 + (0.3287146 * d), E9  =  34.226 + ( 1.7484877 * d),
-				        E10 =  15.134 - ( 0.1589763 * d), E11 = 119.743 + (0.0036096 * d), E12 = 239.961 + ( 0.1643573 * d),
-				        E13 =  25.053 + (12.9590088 * d);
+				if (remainder >= divisor) {
+					remainder -= divisor;
+				}
 				
-				return {
-					269.9949 + (0.0031 * _t)    - (3.8787 * sin_d(E1)) - (0.1204 * sin_d(E2))
-						+ (0.0700 * sin_d(E3 )) - (0.0172 * sin_d(E4)) + (0.0072 * sin_d(E6))
-						- (0.0052 * sin_d(E10)) + (0.0043 * sin_d(E13)),
-						
-					66.5392 + (0.0130 * _t)    + (1.5419 * cos_d(E1 )) + (0.0239 * cos_d(E2 ))
-						- (0.0278 * cos_d(E3)) + (0.0068 * cos_d(E4 )) - (0.0029 * cos_d(E6 ))
-						+ (0.0009 * cos_d(E7)) + (0.0008 * cos_d(E10)) - (0.0009 * cos_d(E13)),
-						
-					38.3213 + (13.17635815 * d) - (1.4 * std::pow(10.0, -12.0) * (d * d)) + (3.5610 * sin_d(E1))
-						+ (0.1208 * sin_d(E2 )) - (0.0642 * sin_d(E3 )) + (0.0158 * sin_d(E4 ))
-						+ (0.0252 * sin_d(E5 )) - (0.0066 * sin_d(E6 )) - (0.0047 * sin_d(E7 ))
-						- (0.0046 * sin_d(E8 )) + (0.0028 * sin_d(E9 )) + (0.0052 * sin_d(E10))
-						+ (0.0040 * sin_d(E11)) + (0.0019 * sin_d(E12)) - (0.0044 * sin_d(E13))
-				};
+				divisor /= static_cast<T>(2.0);
+			}
+			
+			return _x < static_cast<T>(0.0) ? -remainder : remainder;
+		}
+		
+		/**
+		 * @brief Rounds towards zero, usable in constant expressions and safe at any magnitude.
+		 *
+		 * @param[in] _x The input value.
+		 * @return The integral part of \p _x, or \p _x itself if it is not finite.
+		 */
+		template<typename T>
+		static constexpr T truncate(const T& _x) {
+			
+			if (_x < s_TruncationLimit<T> && _x > -s_TruncationLimit<T>) {
+				return static_cast<T>(static_cast<std::int64_t>(_x));
+			}
+			
+			// Beyond 2^62, every value with at most 63 significant bits is already integral (this includes NaN and infinity).
+			if constexpr (std::numeric_limits<T>::digits <= 63) {
+				return _x;
+			}
+			else {
+				return _x - _x != static_cast<T>(0.0) ? _x : _x - fmod_exact(_x, static_cast<T>(1.0));
+			}
+		}
+		
+		/**
+		 * @brief Calculates the floating-point remainder of an angle in degrees divided by 360.
+		 *
+		 * @details Equivalent to std::fmod(_x, 360), including the sign of the result, but usable in constant expressions.
+		 * Truncating the quotient is exact while |_x| < 2^digits (and the quotient fits std::int64_t); larger angles are
+		 * reduced exactly by fmod_exact() instead.
+		 *
+		 * @param[in] _x The input angle in degrees.
+		 * @return The remainder, in (-360, 360), or NaN if \p _x is not finite.
+		 */
+		template<typename T>
+		static constexpr T fmod_d(const T& _x) {
+			
+			constexpr T full = static_cast<T>(360.0);
+			
+			constexpr T limit = static_cast<T>(std::uint64_t(1U) << std::min(std::numeric_limits<T>::digits, 62));
+			
+			if (!(_x < limit && _x > -limit)) {
+				return fmod_exact(_x, full);
 			}
+			
+			const T quotient = _x / full;
+			
+			T result = _x - (static_cast<T>(static_cast<std::int64_t>(quotient)) * full);
+			
+			// The quotient may have been rounded across an integer, leaving the remainder outside of the expected range.
+			if (_x >= static_cast<T>(0.0)) {
+				     if (result <  static_cast<T>(0.0)) { result += full; }
+				else if (result >= full               ) { result -= full; }
+			}
+			else {
+				     if (result >  static_cast<T>(0.0)) { result -= full; }
+				else if (result <= -full              ) { result += full; }
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Calculates the product of two values together with its rounding error, such that _hi + _lo == _a * _b.
+		 *
+		 * @details Uses a fused multiply-add where the target provides a fast one, and Dekker's product otherwise.
+		 *
+		 * @param[in] _a The first factor.
+		 * @param[in] _b The second factor.
+		 * @param[out] _hi The rounded product.
+		 * @param[out] _lo The rounding error of the product.
+		 */
+		template<typename T>
+		static constexpr void two_product(const T& _a, const T& _b, T& _hi, T& _lo) {
+			
+			_hi = _a * _b;
+
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+			if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+				
+				if (!is_constant_evaluated()) {
+					_lo = std::fma(_a, _b, -_hi);
+					
+					return;
+				}
+			}
+#endif
+			
+			constexpr T split = static_cast<T>((std::uint64_t(1U) << ((std::numeric_limits<T>::digits + 1) / 2)) + 1U);
+			
+			const T ca = split * _a;
+			const T cb = split * _b;
+			
+			const T ah = ca - (ca - _a), al = _a - ah;
+			const T bh = cb - (cb - _b), bl = _b - bh;
+			
+			_lo = (((ah * bh) - _hi) + (ah * bl) + (al * bh)) + (al * bl);
+		}
+		
+		/**
+		 * @brief Vector types used by the degree-domain trigonometric kernel and the LookupTable interpolation kernel.
+		 *
+		 * @details Each type wraps one instruction set behind a common set of lane-wise operations, allowing the kernels to
+		 * be written once. Native<T> selects the widest type available for the target, falling back to Scalar<T>. gather()
+		 * loads one element per lane from indices held as whole numbers of \p T, using gather instructions where AVX2 is
+		 * enabled at compile time.
+		 */
+		struct SIMD final {
+			
+			/**
+			 * @brief Portable single-lane fallback.
+			 */
+			template<typename T>
+			struct Scalar final {
+				
+				using scalar = T;
+				using type   = T;
+				using mask   = bool;
+				
+				static constexpr std::size_t width = 1U;
+				
+				static constexpr type load(const scalar* _p) { return *_p; }
+				
+				static constexpr void store(scalar* _p, const type& _v) { *_p = _v; }
+				
+				static constexpr type set1(const scalar& _v) { return _v; }
+				
+				static constexpr type add(const type& _a, const type& _b) { return _a + _b; }
+				static constexpr type sub(const type& _a, const type& _b) { return _a - _b; }
+				static constexpr type mul(const type& _a, const type& _b) { return _a * _b; }
+				
+				static constexpr type madd(const type& _a, const type& _b, const type& _c) { return (_a * _b) + _c; }
+				
+				static constexpr type round(const type& _a) {
+					return truncate(_a + (_a < static_cast<T>(0.0) ? static_cast<T>(-0.5) : static_cast<T>(0.5)));
+				}
+				
+				static constexpr type floor(const type& _a) {
+					
+					const auto result = truncate(_a);
+					
+					return result > _a ? result - static_cast<T>(1.0) : result;
+				}
+				
+				static constexpr mask eq(const type& _a, const type& _b) { return _a == _b; }
+				static constexpr mask ge(const type& _a, const type& _b) { return _a >= _b; }
+				
+				static constexpr type select(const mask& _m, const type& _a, const type& _b) { return _m ? _a : _b; }
+				
+				static constexpr type neg(const type& _a) { return -_a; }
+				
+				static constexpr type gather(const scalar* _p, const type& _i) { return _p[static_cast<std::size_t>(_i)]; }
+			};
+
+#if defined(__SSE2__) || defined(_M_X64)
+			
+			/**
+			 * @brief Two double-precision lanes (SSE2, using SSE4.1 and FMA where available).
+			 */
+			struct SSE2_F64 final {
+				
+				using scalar = double;
+				using type   = __m128d;
+				using mask   = __m128d;
+				
+				static constexpr std::size_t width = 2U;
+				
+				static type load(const scalar* _p) { return _mm_loadu_pd(_p); }
+				
+				static void store(scalar* _p, const type& _v) { _mm_storeu_pd(_p, _v); }
+				
+				static type set1(const scalar& _v) { return _mm_set1_pd(_v); }
+				
+				static type add(const type& _a, const type& _b) { return _mm_add_pd(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return _mm_sub_pd(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return _mm_mul_pd(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) {
+#if defined(__FMA__)
+					return _mm_fmadd_pd(_a, _b, _c);
+#else
+					return add(mul(_a, _b), _c);
+#endif
+				}
+				
+				static type round(const type& _a) {
+#if defined(__SSE4_1__)
+					return _mm_round_pd(_a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+					// Adding and subtracting 1.5 * 2^52 rounds to the nearest integer for |_a| < 2^51.
+					const auto magic = set1(6755399441055744.0);
+					
+					// The magic constant rounds only for |_a| < 2^51; beyond 2^52 (and for NaN) every lane is already integral.
+					const auto integral = _mm_cmpnlt_pd(_mm_andnot_pd(set1(-0.0), _a), set1(4503599627370496.0));
+					
+					return select(integral, _a, sub(add(_a, magic), magic));
+#endif
+				}
+				
+				static type floor(const type& _a) {
+#if defined(__SSE4_1__)
+					return _mm_floor_pd(_a);
+#else
+					const auto result = round(_a);
+					
+					return sub(result, _mm_and_pd(_mm_cmpgt_pd(result, _a), set1(1.0)));
+#endif
+				}
+				
+				static mask eq(const type& _a, const type& _b) { return _mm_cmpeq_pd(_a, _b); }
+				static mask ge(const type& _a, const type& _b) { return _mm_cmpge_pd(_a, _b); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) {
+#if defined(__SSE4_1__)
+					return _mm_blendv_pd(_b, _a, _m);
+#else
+					return _mm_or_pd(_mm_and_pd(_m, _a), _mm_andnot_pd(_m, _b));
+#endif
+				}
+				
+				static type neg(const type& _a) { return _mm_xor_pd(_a, set1(-0.0)); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+					
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+				}
+			};
+			
+			/**
+			 * @brief Four single-precision lanes (SSE2, using SSE4.1 and FMA where available).
+			 */
+			struct SSE2_F32 final {
+				
+				using scalar = float;
+				using type   = __m128;
+				using mask   = __m128;
+				
+				static constexpr std::size_t width = 4U;
+				
+				static type load(const scalar* _p) { return _mm_loadu_ps(_p); }
+				
+				static void store(scalar* _p, const type& _v) { _mm_storeu_ps(_p, _v); }
+				
+				static type set1(const scalar& _v) { return _mm_set1_ps(_v); }
+				
+				static type add(const type& _a, const type& _b) { return _mm_add_ps(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return _mm_sub_ps(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return _mm_mul_ps(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) {
+#if defined(__FMA__)
+					return _mm_fmadd_ps(_a, _b, _c);
+#else
+					return add(mul(_a, _b), _c);
+#endif
+				}
+				
+				static type round(const type& _a) {
+#if defined(__SSE4_1__)
+					return _mm_round_ps(_a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+					// The conversion saturates beyond 2^31; beyond 2^23 (and for NaN) every lane is already integral.
+					const auto integral = _mm_cmpnlt_ps(_mm_andnot_ps(set1(-0.0F), _a), set1(8388608.0F));
+					
+					return _mm_or_ps(_mm_and_ps(integral, _a), _mm_andnot_ps(integral, _mm_cvtepi32_ps(_mm_cvtps_epi32(_a))));
+#endif
+				}
+				
+				static type floor(const type& _a) {
+#if defined(__SSE4_1__)
+					return _mm_floor_ps(_a);
+#else
+					const auto result = round(_a);
+					
+					return sub(result, _mm_and_ps(_mm_cmpgt_ps(result, _a), set1(1.0F)));
+#endif
+				}
+				
+				static mask eq(const type& _a, const type& _b) { return _mm_cmpeq_ps(_a, _b); }
+				static mask ge(const type& _a, const type& _b) { return _mm_cmpge_ps(_a, _b); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) {
+#if defined(__SSE4_1__)
+					return _mm_blendv_ps(_b, _a, _m);
+#else
+					return _mm_or_ps(_mm_and_ps(_m, _a), _mm_andnot_ps(_m, _b));
+#endif
+				}
+				
+				static type neg(const type& _a) { return _mm_xor_ps(_a, set1(-0.0F)); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+					
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+				}
+			};
+#endif
+
+#if defined(__AVX__)
+			
+			/**
+			 * @brief Four double-precision lanes (AVX, using FMA where available).
+			 */
+			struct AVX_F64 final {
+				
+				using scalar = double;
+				using type   = __m256d;
+				using mask   = __m256d;
+				
+				static constexpr std::size_t width = 4U;
+				
+				static type load(const scalar* _p) { return _mm256_loadu_pd(_p); }
+				
+				static void store(scalar* _p, const type& _v) { _mm256_storeu_pd(_p, _v); }
+				
+				static type set1(const scalar& _v) { return _mm256_set1_pd(_v); }
+				
+				static type add(const type& _a, const type& _b) { return _mm256_add_pd(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return _mm256_sub_pd(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return _mm256_mul_pd(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) {
+#if defined(__FMA__)
+					return _mm256_fmadd_pd(_a, _b, _c);
+#else
+					return add(mul(_a, _b), _c);
+#endif
+				}
+				
+				static type round(const type& _a) { return _mm256_round_pd(_a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static type floor(const type& _a) { return _mm256_floor_pd(_a); }
+				
+				static mask eq(const type& _a, const type& _b) { return _mm256_cmp_pd(_a, _b, _CMP_EQ_OQ); }
+				static mask ge(const type& _a, const type& _b) { return _mm256_cmp_pd(_a, _b, _CMP_GE_OQ); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) { return _mm256_blendv_pd(_b, _a, _m); }
+				
+				static type neg(const type& _a) { return _mm256_xor_pd(_a, set1(-0.0)); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+#if defined(__AVX2__)
+					// The masked form is used as the unmasked one reads an undefined source, which GCC warns of.
+					const auto all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+					
+					return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), _p, _mm256_cvttpd_epi32(_i), all, 8);
+#else
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+#endif
+				}
+			};
+			
+			/**
+			 * @brief Eight single-precision lanes (AVX, using FMA where available).
+			 */
+			struct AVX_F32 final {
+				
+				using scalar = float;
+				using type   = __m256;
+				using mask   = __m256;
+				
+				static constexpr std::size_t width = 8U;
+				
+				static type load(const scalar* _p) { return _mm256_loadu_ps(_p); }
+				
+				static void store(scalar* _p, const type& _v) { _mm256_storeu_ps(_p, _v); }
+				
+				static type set1(const scalar& _v) { return _mm256_set1_ps(_v); }
+				
+				static type add(const type& _a, const type& _b) { return _mm256_add_ps(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return _mm256_sub_ps(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return _mm256_mul_ps(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) {
+#if defined(__FMA__)
+					return _mm256_fmadd_ps(_a, _b, _c);
+#else
+					return add(mul(_a, _b), _c);
+#endif
+				}
+				
+				static type round(const type& _a) { return _mm256_round_ps(_a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static type floor(const type& _a) { return _mm256_floor_ps(_a); }
+				
+				static mask eq(const type& _a, const type& _b) { return _mm256_cmp_ps(_a, _b, _CMP_EQ_OQ); }
+				static mask ge(const type& _a, const type& _b) { return _mm256_cmp_ps(_a, _b, _CMP_GE_OQ); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) { return _mm256_blendv_ps(_b, _a, _m); }
+				
+				static type neg(const type& _a) { return _mm256_xor_ps(_a, set1(-0.0F)); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+#if defined(__AVX2__)
+					// The masked form is used as the unmasked one reads an undefined source, which GCC warns of.
+					const auto all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					
+					return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), _p, _mm256_cvttps_epi32(_i), all, 4);
+#else
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+#endif
+				}
+			};
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+			
+			/**
+			 * @brief Two double-precision lanes (AArch64 NEON).
+			 */
+			struct NEON_F64 final {
+				
+				using scalar = double;
+				using type   = float64x2_t;
+				using mask   = uint64x2_t;
+				
+				static constexpr std::size_t width = 2U;
+				
+				static type load(const scalar* _p) { return vld1q_f64(_p); }
+				
+				static void store(scalar* _p, const type& _v) { vst1q_f64(_p, _v); }
+				
+				static type set1(const scalar& _v) { return vdupq_n_f64(_v); }
+				
+				static type add(const type& _a, const type& _b) { return vaddq_f64(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return vsubq_f64(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return vmulq_f64(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) { return vfmaq_f64(_c, _a, _b); }
+				
+				static type round(const type& _a) { return vrndnq_f64(_a); }
+				static type floor(const type& _a) { return vrndmq_f64(_a); }
+				
+				static mask eq(const type& _a, const type& _b) { return vceqq_f64(_a, _b); }
+				static mask ge(const type& _a, const type& _b) { return vcgeq_f64(_a, _b); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) { return vbslq_f64(_m, _a, _b); }
+				
+				static type neg(const type& _a) { return vnegq_f64(_a); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+					
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+				}
+			};
+			
+			/**
+			 * @brief Four single-precision lanes (AArch64 NEON).
+			 */
+			struct NEON_F32 final {
+				
+				using scalar = float;
+				using type   = float32x4_t;
+				using mask   = uint32x4_t;
+				
+				static constexpr std::size_t width = 4U;
+				
+				static type load(const scalar* _p) { return vld1q_f32(_p); }
+				
+				static void store(scalar* _p, const type& _v) { vst1q_f32(_p, _v); }
+				
+				static type set1(const scalar& _v) { return vdupq_n_f32(_v); }
+				
+				static type add(const type& _a, const type& _b) { return vaddq_f32(_a, _b); }
+				static type sub(const type& _a, const type& _b) { return vsubq_f32(_a, _b); }
+				static type mul(const type& _a, const type& _b) { return vmulq_f32(_a, _b); }
+				
+				static type madd(const type& _a, const type& _b, const type& _c) { return vfmaq_f32(_c, _a, _b); }
+				
+				static type round(const type& _a) { return vrndnq_f32(_a); }
+				static type floor(const type& _a) { return vrndmq_f32(_a); }
+				
+				static mask eq(const type& _a, const type& _b) { return vceqq_f32(_a, _b); }
+				static mask ge(const type& _a, const type& _b) { return vcgeq_f32(_a, _b); }
+				
+				static type select(const mask& _m, const type& _a, const type& _b) { return vbslq_f32(_m, _a, _b); }
+				
+				static type neg(const type& _a) { return vnegq_f32(_a); }
+				
+				static type gather(const scalar* _p, const type& _i) {
+					
+					std::array<scalar, width> i{}, result{};
+					store(i.data(), _i);
+					
+					for (std::size_t j = 0U; j < width; ++j) {
+						result[j] = _p[static_cast<std::size_t>(i[j])];
+					}
+					
+					return load(result.data());
+				}
+			};
+#endif
+			
+#if defined(LOUIERIKSSON_WGCCRE_DISPATCH)
+			
+			/**
+			 * @brief \p W lanes of \p T held as two halves, written with compiler vector extensions rather than intrinsics.
+			 *
+			 * @details No operation names an instruction set, so once inlined each is compiled for the target of the calling
+			 * function. Splitting the lanes across two halves keeps the type in memory as far as the calling convention is
+			 * concerned, so it never changes ABI between targets. Only use from functions given a target attribute at least
+			 * as wide as one half.
+			 */
+			template<typename T, std::size_t W>
+			struct Vector final {
+				
+				using lane_t = std::conditional_t<sizeof(T) == 8U, std::int64_t, std::int32_t>;
+				
+				using half_type [[gnu::vector_size((W / 2U) * sizeof(T))]] = T;
+				using half_mask [[gnu::vector_size((W / 2U) * sizeof(T))]] = lane_t;
+				
+				struct type final { half_type h[2U]; };
+				struct mask final { half_mask h[2U]; };
+				
+				using scalar = T;
+				
+				static constexpr std::size_t width = W;
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type load(const scalar* _p) {
+					
+					type result;
+					std::memcpy(&result.h[0U], _p,            sizeof(half_type));
+					std::memcpy(&result.h[1U], _p + (W / 2U), sizeof(half_type));
+					
+					return result;
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static void store(scalar* _p, const type& _v) {
+					std::memcpy(_p,            &_v.h[0U], sizeof(half_type));
+					std::memcpy(_p + (W / 2U), &_v.h[1U], sizeof(half_type));
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type set1(const scalar& _v) { return {{ half_type{} + _v, half_type{} + _v }}; }
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type add(const type& _a, const type& _b) { return {{ _a.h[0U] + _b.h[0U], _a.h[1U] + _b.h[1U] }}; }
+				LOUIERIKSSON_WGCCRE_INLINE static type sub(const type& _a, const type& _b) { return {{ _a.h[0U] - _b.h[0U], _a.h[1U] - _b.h[1U] }}; }
+				LOUIERIKSSON_WGCCRE_INLINE static type mul(const type& _a, const type& _b) { return {{ _a.h[0U] * _b.h[0U], _a.h[1U] * _b.h[1U] }}; }
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type madd(const type& _a, const type& _b, const type& _c) {
+					return {{ (_a.h[0U] * _b.h[0U]) + _c.h[0U], (_a.h[1U] * _b.h[1U]) + _c.h[1U] }};
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type round(const type& _a) {
+					
+					// Adding and subtracting 1.5 * 2^(digits - 1) rounds to the nearest integer for |_a| < 2^(digits - 2). The kernel
+					// only rounds quotients of angles by 90 degrees, which are far smaller at any epoch the library accepts, and a
+					// per-lane guard here would keep the compiler from vectorising the kernel.
+					const auto magic = set1(static_cast<T>(std::uint64_t(3U) << (std::numeric_limits<T>::digits - 2)));
+					
+					return sub(add(_a, magic), magic);
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type floor(const type& _a) {
+					
+					const auto result = round(_a);
+					
+					return sub(result, select({{ result.h[0U] > _a.h[0U], result.h[1U] > _a.h[1U] }}, set1(static_cast<T>(1.0)), type{}));
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static mask eq(const type& _a, const type& _b) { return {{ _a.h[0U] == _b.h[0U], _a.h[1U] == _b.h[1U] }}; }
+				LOUIERIKSSON_WGCCRE_INLINE static mask ge(const type& _a, const type& _b) { return {{ _a.h[0U] >= _b.h[0U], _a.h[1U] >= _b.h[1U] }}; }
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type select(const mask& _m, const type& _a, const type& _b) {
+					
+					type result;
+					for (std::size_t i = 0U; i < 2U; ++i) {
+						result.h[i] = reinterpret_cast<half_type>((_m.h[i] & reinterpret_cast<half_mask>(_a.h[i])) | (~_m.h[i] & reinterpret_cast<half_mask>(_b.h[i])));
+					}
+					
+					return result;
+				}
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type neg(const type& _a) { return {{ -_a.h[0U], -_a.h[1U] }}; }
+				
+				LOUIERIKSSON_WGCCRE_INLINE static type gather(const scalar* _p, const type& _i) {
+					
+					type result;
+					for (std::size_t i = 0U; i < 2U; ++i) {
+						for (std::size_t j = 0U; j < W / 2U; ++j) {
+							result.h[i][j] = _p[static_cast<std::size_t>(_i.h[i][j])];
+						}
+					}
+					
+					return result;
+				}
+			};
+#endif
+			
+			/**
+			 * @brief The widest vector type available for \p T on the current target.
+			 */
+			template<typename T>
+			using Native =
+#if defined(__AVX__)
+				std::conditional_t<std::is_same_v<T, double>, AVX_F64,
+				std::conditional_t<std::is_same_v<T, float >, AVX_F32, Scalar<T>>>;
+#elif defined(__SSE2__) || defined(_M_X64)
+				std::conditional_t<std::is_same_v<T, double>, SSE2_F64,
+				std::conditional_t<std::is_same_v<T, float >, SSE2_F32, Scalar<T>>>;
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+				std::conditional_t<std::is_same_v<T, double>, NEON_F64,
+				std::conditional_t<std::is_same_v<T, float >, NEON_F32, Scalar<T>>>;
+#else
+				Scalar<T>;
+#endif
+		};
+		
+		/**
+		 * @brief Computes the sine and cosine of angles in degrees, sharing a single range reduction between both.
+		 *
+		 * @details The angle is reduced to the nearest multiple of 90 degrees in the degree domain, where the reduction is
+		 * exact. Both results are then evaluated from minimax polynomials over the octant and swapped or negated according
+		 * to the quadrant. The coefficients of the polynomials are scaled by powers of the degree-to-radian factor at
+		 * compile time, so the reduced angle is never converted to radians. Types other than float and double use a
+		 * Taylor series of sufficient length for extended and quadruple precision.
+		 *
+		 * @param[in] _x The input angles in degrees.
+		 * @param[out] _sin The sines of the input angles.
+		 * @param[out] _cos The cosines of the input angles.
+		 */
+		template<typename V>
+		LOUIERIKSSON_WGCCRE_INLINE static constexpr void sincos_kernel(const typename V::type& _x, typename V::type& _sin, typename V::type& _cos) {
+			
+			using T = typename V::scalar;
+			
+			constexpr auto D2R = 3.14159265358979323846264338327950288L / 180.0L;
+			
+			/* Coefficient of u^_n, reduced to T, of a polynomial in radians whose coefficient of r^_n is _c. */
+			constexpr auto fold = [](const long double& _c, const std::size_t& _n) {
+				
+				long double result = _c;
+				for (std::size_t i = 0U; i < _n; ++i) {
+					result *= D2R;
+				}
+				
+				return static_cast<T>(result);
+			};
+			
+			const auto q = V::round(V::mul(_x, V::set1(static_cast<T>(1.0L / 90.0L))));
+			const auto u = V::sub(_x, V::mul(q, V::set1(static_cast<T>(90.0))));
+			const auto z = V::mul(u, u);
+			
+			typename V::type s{}, c{};
+			
+			if constexpr (std::is_same_v<T, double>) {
+				
+				constexpr std::array<T, 6U> S {
+					fold(-1.66666666666666324348e-01L,  3U),
+					fold( 8.33333333332248946124e-03L,  5U),
+					fold(-1.98412698298579493134e-04L,  7U),
+					fold( 2.75573137070700676789e-06L,  9U),
+					fold(-2.50507602534068634195e-08L, 11U),
+					fold( 1.58969099521155010221e-10L, 13U)
+				};
+				
+				constexpr std::array<T, 7U> C {
+					fold(-0.5L,                         2U),
+					fold( 4.16666666666666019037e-02L,  4U),
+					fold(-1.38888888888741095749e-03L,  6U),
+					fold( 2.48015872894767294178e-05L,  8U),
+					fold(-2.75573143513906633035e-07L, 10U),
+					fold( 2.08757232129817482790e-09L, 12U),
+					fold(-1.13596475577881948265e-11L, 14U)
+				};
+				
+				s = V::madd(V::mul(u, z),
+				    V::madd(z, V::madd(z, V::madd(z, V::madd(z, V::madd(z,
+				    V::set1(S[5]),
+				    V::set1(S[4])),
+				    V::set1(S[3])),
+				    V::set1(S[2])),
+				    V::set1(S[1])),
+				    V::set1(S[0])), V::mul(u, V::set1(fold(1.0L, 1U))));
+				
+				c = V::madd(V::mul(z, z),
+				    V::madd(z, V::madd(z, V::madd(z, V::madd(z, V::madd(z,
+				    V::set1(C[6]),
+				    V::set1(C[5])),
+				    V::set1(C[4])),
+				    V::set1(C[3])),
+				    V::set1(C[2])),
+				    V::set1(C[1])), V::madd(z, V::set1(C[0]), V::set1(1.0)));
+			}
+			else if constexpr (std::is_same_v<T, float>) {
+				
+				constexpr std::array<T, 3U> S {
+					fold(-1.6666654611e-01L, 3U),
+					fold( 8.3321608736e-03L, 5U),
+					fold(-1.9515295891e-04L, 7U)
+				};
+				
+				constexpr std::array<T, 4U> C {
+					fold(-0.5L,                  2U),
+					fold( 4.166664568298827e-02L, 4U),
+					fold(-1.388731625493765e-03L, 6U),
+					fold( 2.443315711809948e-05L, 8U)
+				};
+				
+				s = V::madd(V::mul(u, z),
+				    V::madd(z, V::madd(z,
+				    V::set1(S[2]),
+				    V::set1(S[1])),
+				    V::set1(S[0])), V::mul(u, V::set1(fold(1.0L, 1U))));
+				
+				c = V::madd(V::mul(z, z),
+				    V::madd(z, V::madd(z,
+				    V::set1(C[3]),
+				    V::set1(C[2])),
+				    V::set1(C[1])), V::madd(z, V::set1(C[0]), V::set1(1.0F)));
+			}
+			else {
+				
+				// Taylor series to r^31, accurate to beyond quadruple precision over the octant.
+				constexpr std::size_t terms = 16U;
+				
+				// Signed inverse factorials, scaled by powers of the degree-to-radian factor.
+				constexpr auto coefficients = [] {
+					
+					const T d2r = static_cast<T>(3.14159265358979323846264338327950288L) / static_cast<T>(180.0);
+					
+					std::array<T, 2U * terms> result{};
+					
+					T value = static_cast<T>(1.0);
+					for (std::size_t i = 0U; i < result.size(); ++i) {
+						
+						if (i > 0U) {
+							value *= d2r / static_cast<T>(i);
+						}
+						
+						result[i] = ((i / 2U) % 2U == 0U) ? value : -value;
+					}
+					
+					return result;
+				}();
+				
+				for (std::size_t i = terms; i-- > 0U;) {
+					s = (s * z) + coefficients[(2U * i) + 1U];
+					c = (c * z) + coefficients[ 2U * i      ];
+				}
+				
+				s *= u;
+			}
+			
+			const auto one = V::set1(static_cast<T>(1.0));
+			const auto two = V::set1(static_cast<T>(2.0));
+			
+			const auto half = V::set1(static_cast<T>(0.5));
+			
+			// Quadrant of the input angle, in [0, 4). As q is integral, floor(q / 4) is q / 4 - 3/8 rounded to the nearest
+			// integer, which is never a tie; this avoids the compare and select of a floor, and likewise below.
+			const auto q4 = V::sub(q, V::mul(V::round(V::madd(q, V::set1(static_cast<T>(0.25)), V::set1(static_cast<T>(-0.375)))), V::set1(static_cast<T>(4.0))));
+			
+			// Odd quadrants swap sine and cosine; quadrants 2 and 3 negate the sine, and 1 and 2 the cosine.
+			const auto swap     = V::eq(V::sub(q4, V::mul(V::round(V::madd(q4, half, V::set1(static_cast<T>(-0.25)))), two)), one);
+			const auto sin_sign = V::ge(q4, two);
+			const auto cos_sign = V::eq(V::round(V::madd(q4, half, V::set1(static_cast<T>(0.25)))), one);
+			
+			const auto sin_q = V::select(swap, c, s);
+			const auto cos_q = V::select(swap, s, c);
+			
+			_sin = V::select(sin_sign, V::neg(sin_q), sin_q);
+			_cos = V::select(cos_sign, V::neg(cos_q), cos_q);
+		}
+		
+		/**
+		 * @brief Calculates the sine and cosine of an angle in degrees.
+		 *
+		 * @param[in] _x The input angle in degrees.
+		 * @param[out] _sin The sine of the input angle.
+		 * @param[out] _cos The cosine of the input angle.
+		 */
+		template<typename T>
+		static constexpr void sincos_d(const T& _x, T& _sin, T& _cos) {
+			sincos_kernel<SIMD::Scalar<T>>(_x, _sin, _cos);
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of as many whole vectors of angles in degrees as fit in \p _count.
+		 *
+		 * @return The number of angles processed, a multiple of the width of \p V.
+		 */
+		template<typename V>
+		LOUIERIKSSON_WGCCRE_INLINE static std::size_t sincos_loop(const typename V::scalar* _x, typename V::scalar* _sin, typename V::scalar* _cos, const std::size_t& _count) {
+			
+			std::size_t i = 0U;
+			
+			if constexpr (V::width > 1U) {
+				
+				for (; i + V::width <= _count; i += V::width) {
+					
+					typename V::type s{}, c{};
+					sincos_kernel<V>(V::load(_x + i), s, c);
+					
+					V::store(_sin + i, s);
+					V::store(_cos + i, c);
+				}
+			}
+			
+			return i;
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of fewer angles than fill a vector, as one vector padded with zeroes.
+		 *
+		 * @details A partial vector costs as much as a whole one, so a short remainder is cheaper to pad than to pass to
+		 * a narrower type, and far cheaper than to evaluate angle by angle.
+		 *
+		 * @param[in] _count Number of angles, less than the width of \p V.
+		 */
+		template<typename V>
+		LOUIERIKSSON_WGCCRE_INLINE static void sincos_tail(const typename V::scalar* _x, typename V::scalar* _sin, typename V::scalar* _cos, const std::size_t& _count) {
+			
+			using T = typename V::scalar;
+			
+			if (_count == 0U) {
+				return;
+			}
+			
+			if constexpr (V::width == 1U) {
+				sincos_d(*_x, *_sin, *_cos);
+			}
+			else {
+				
+				std::array<T, V::width> x{}, s{}, c{};
+				std::copy_n(_x, _count, x.data());
+				
+				typename V::type sv{}, cv{};
+				sincos_kernel<V>(V::load(x.data()), sv, cv);
+				
+				V::store(s.data(), sv);
+				V::store(c.data(), cv);
+				
+				std::copy_n(s.data(), _count, _sin);
+				std::copy_n(c.data(), _count, _cos);
+			}
+		}
+		
+		/**
+		 * @brief Returns the instruction set of SIMD::Native<T>, that is, the widest one enabled at compile time.
+		 */
+		template<typename T>
+		static constexpr InstructionSet GetNativeInstructionSet() {
+			
+			using V = SIMD::Native<T>;
+			
+			if constexpr (V::width == 1U) {
+				return InstructionSet::Scalar;
+			}
+			else {
+#if defined(__AVX__)
+				return InstructionSet::AVX;
+#elif defined(__SSE2__) || defined(_M_X64)
+				return InstructionSet::SSE2;
+#else
+				return InstructionSet::NEON;
+#endif
+			}
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of many angles in degrees using SIMD::Native<T>.
+		 */
+		template<typename T>
+		LOUIERIKSSON_WGCCRE_INLINE static void sincos_native(const T* _x, T* _sin, T* _cos, const std::size_t& _count) {
+			
+			using V = SIMD::Native<T>;
+			
+			if constexpr (V::width == 1U) {
+				
+				for (std::size_t i = 0U; i < _count; ++i) {
+					sincos_d(_x[i], _sin[i], _cos[i]);
+				}
+			}
+			else {
+				
+				const auto i = sincos_loop<V>(_x, _sin, _cos, _count);
+				
+				sincos_tail<V>(_x + i, _sin + i, _cos + i, _count - i);
+			}
+		}
+
+#if defined(LOUIERIKSSON_WGCCRE_DISPATCH)
+		
+		/**
+		 * @brief Calculates the sines and cosines of many angles in degrees using AVX2 and FMA, however compiled.
+		 */
+		template<typename T>
+		[[gnu::target("avx2,fma")]] static void sincos_avx2(const T* _x, T* _sin, T* _cos, const std::size_t& _count) {
+			
+			using V = SIMD::Vector<T, 64U / sizeof(T)>;
+			
+			const auto i = sincos_loop<V>(_x, _sin, _cos, _count);
+			
+			sincos_tail<V>(_x + i, _sin + i, _cos + i, _count - i);
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of many angles in degrees using AVX-512, however compiled.
+		 */
+		template<typename T>
+		[[gnu::target("avx512f,avx512dq")]] static void sincos_avx512(const T* _x, T* _sin, T* _cos, const std::size_t& _count) {
+			
+			using V = SIMD::Vector<T, 128U / sizeof(T)>;
+			
+			const auto i = sincos_loop<V>(_x, _sin, _cos, _count);
+			
+			sincos_tail<V>(_x + i, _sin + i, _cos + i, _count - i);
+		}
+#endif
+		
+		/**
+		 * @brief Selects the widest batched trigonometry supported by the running CPU.
+		 *
+		 * @return The selected kernel and its instruction set. Without runtime dispatch, always the native kernel.
+		 */
+		template<typename T>
+		static std::pair<void (*)(const T*, T*, T*, const std::size_t&), InstructionSet> SelectSinCos() {
+
+#if defined(LOUIERIKSSON_WGCCRE_DISPATCH)
+			if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+				
+				__builtin_cpu_init();
+				
+				if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+					return { &sincos_avx512<T>, InstructionSet::AVX512 };
+				}
+				
+				if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+					return { &sincos_avx2<T>, InstructionSet::AVX2 };
+				}
+			}
+#endif
+			
+			return { &sincos_native<T>, GetNativeInstructionSet<T>() };
+		}
+		
+		/**
+		 * @brief Returns the batched trigonometry selected for the running CPU, choosing it on first use.
+		 */
+		template<typename T>
+		static const std::pair<void (*)(const T*, T*, T*, const std::size_t&), InstructionSet>& GetSinCos() {
+			
+			static const auto s_SinCos = SelectSinCos<T>();
+			
+			return s_SinCos;
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of many angles in degrees, using the widest vector type available.
+		 *
+		 * @details Where runtime dispatch is enabled, the widest instruction set supported by the running CPU is used,
+		 * regardless of those enabled at compile time.
+		 *
+		 * @param[in] _x Pointer to the first of \p _count input angles in degrees.
+		 * @param[out] _sin Pointer to storage for \p _count sines.
+		 * @param[out] _cos Pointer to storage for \p _count cosines.
+		 * @param[in] _count Number of angles.
+		 */
+		template<typename T>
+		static constexpr void sincos_d(const T* _x, T* _sin, T* _cos, const std::size_t& _count) {
+			
+			// Intrinsics cannot be constant-evaluated, so leave every angle to the scalar loop at compile time.
+			if (is_constant_evaluated()) {
+				
+				for (std::size_t i = 0U; i < _count; ++i) {
+					sincos_d(_x[i], _sin[i], _cos[i]);
+				}
+			}
+			else {
+				GetSinCos<T>().first(_x, _sin, _cos, _count);
+			}
+		}
+		
+		/**
+		 * @brief Calculates the sines and cosines of a fixed set of angles in degrees.
+		 *
+		 * @param[in] _x The input angles in degrees.
+		 * @return The sines and cosines of the input angles, in that order.
+		 */
+		template<typename T, std::size_t N>
+		static constexpr std::array<std::array<T, N>, 2U> sincos_d(const std::array<T, N>& _x) {
+			
+			std::array<std::array<T, N>, 2U> result{};
+			sincos_d(_x.data(), result[0].data(), result[1].data(), N);
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Interpolates one component between the samples of a LookupTable.
+		 *
+		 * @param[in] _samples Pointer to the component in the first record.
+		 * @param[in] _k The offsets of the earlier of the neighbouring records of each lane.
+		 * @param[in] _f The positions of each lane between its neighbouring records, in [0, 1].
+		 */
+		template<typename V, Interpolation I>
+		LOUIERIKSSON_WGCCRE_INLINE static typename V::type lookup_component(const typename V::scalar* _samples, const typename V::type& _k, const typename V::type& _f) {
+			
+			using T = typename V::scalar;
+			
+			const auto p0 = V::gather(_samples,      _k);
+			const auto p1 = V::gather(_samples + 6U, _k);
+			
+			const auto d = V::sub(p1, p0);
+			
+			if constexpr (I == Interpolation::Linear) {
+				return V::madd(d, _f, p0);
+			}
+			else {
+				
+				const auto m0 = V::gather(_samples + 3U, _k);
+				const auto m1 = V::gather(_samples + 9U, _k);
+				
+				// Cubic Hermite in Horner form: p0 + f(m0 + f((3d - 2m0 - m1) + f(m0 + m1 - 2d))).
+				const auto c2 = V::sub(V::mul(d, V::set1(static_cast<T>(3.0))), V::add(V::add(m0, m0), m1));
+				const auto c3 = V::sub(V::add(m0, m1), V::add(d, d));
+				
+				return V::madd(V::madd(V::madd(c3, _f, c2), _f, m0), _f, p0);
+			}
+		}
+		
+		/**
+		 * @brief Interpolates orientations between the samples of a LookupTable.
+		 *
+		 * @details Each sample is a record of six values: alpha, delta and unwrapped W, followed by their changes over one
+		 * step. The neighbouring records are gathered for each lane, and W is reduced modulo 360 after interpolation.
+		 *
+		 * @param[in] _samples Pointer to the first record.
+		 * @param[in] _last Index of the last record, which must be at least 1.
+		 * @param[in] _x The positions to interpolate at, in steps from the first record. Positions outside of the table are
+		 * clamped to its first or last record.
+		 * @param[out] _alpha The interpolated values of alpha.
+		 * @param[out] _delta The interpolated values of delta.
+		 * @param[out] _W The interpolated values of W, in [0, 360).
+		 */
+		template<typename V, Interpolation I>
+		LOUIERIKSSON_WGCCRE_INLINE static void lookup_kernel(const typename V::scalar* _samples, const typename V::scalar& _last, const typename V::type& _x, typename V::type& _alpha, typename V::type& _delta, typename V::type& _W) {
+			
+			using T = typename V::scalar;
+			
+			const auto zero = V::set1(static_cast<T>(0.0));
+			const auto last = V::set1(_last);
+			
+			auto x = V::select(V::ge(_x, zero), _x, zero);
+			x = V::select(V::ge(x, last), last, x);
+			
+			auto i = V::floor(x);
+			i = V::select(V::ge(i, last), V::sub(last, V::set1(static_cast<T>(1.0))), i);
+			
+			const auto f = V::sub(x, i);
+			const auto k = V::mul(i, V::set1(static_cast<T>(6.0)));
+			
+			_alpha = lookup_component<V, I>(_samples + 0U, k, f);
+			_delta = lookup_component<V, I>(_samples + 1U, k, f);
+			
+			const auto W = lookup_component<V, I>(_samples + 2U, k, f);
+			
+			_W = V::sub(W, V::mul(V::floor(V::mul(W, V::set1(static_cast<T>(1.0L / 360.0L)))), V::set1(static_cast<T>(360.0))));
+		}
+		
+		/**
+		 * @brief Interpolates orientations at many epochs with the vector type \p V.
+		 *
+		 * @param[in] _samples Pointer to the first record of the table.
+		 * @param[in] _window The epoch of the first record, the reciprocal of the step, and the index of the last record.
+		 * @return The number of epochs processed, which is a multiple of the width of \p V.
+		 */
+		template<typename V, Interpolation I>
+		LOUIERIKSSON_WGCCRE_INLINE static std::size_t lookup_loop(const typename V::scalar* _samples, const std::array<typename V::scalar, 3U>& _window, const typename V::scalar* _t, const std::size_t& _count, typename V::scalar* _alpha, typename V::scalar* _delta, typename V::scalar* _W) {
+			
+			const auto begin = V::set1(_window[0]);
+			const auto scale = V::set1(_window[1]);
+			
+			std::size_t i = 0U;
+			
+			for (; i + V::width <= _count; i += V::width) {
+				
+				typename V::type a{}, d{}, w{};
+				lookup_kernel<V, I>(_samples, _window[2], V::mul(V::sub(V::load(_t + i), begin), scale), a, d, w);
+				
+				V::store(_alpha + i, a);
+				V::store(_delta + i, d);
+				V::store(_W     + i, w);
+			}
+			
+			return i;
+		}
+		
+		/**
+		 * @brief Interpolates orientations at many epochs using SIMD::Native<T>.
+		 */
+		template<typename T, Interpolation I>
+		LOUIERIKSSON_WGCCRE_INLINE static void lookup_native(const T* _samples, const std::array<T, 3U>& _window, const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const auto i = lookup_loop<SIMD::Native<T>, I>(_samples, _window, _t, _count, _alpha, _delta, _W);
+			
+			lookup_loop<SIMD::Scalar<T>, I>(_samples, _window, _t + i, _count - i, _alpha + i, _delta + i, _W + i);
+		}
+
+#if defined(LOUIERIKSSON_WGCCRE_DISPATCH)
+		
+		/**
+		 * @brief Interpolates orientations at many epochs using AVX2 and FMA, however compiled.
+		 */
+		template<typename T, Interpolation I>
+		[[gnu::target("avx2,fma")]] static void lookup_avx2(const T* _samples, const std::array<T, 3U>& _window, const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const auto i = lookup_loop<SIMD::Vector<T, 64U / sizeof(T)>, I>(_samples, _window, _t, _count, _alpha, _delta, _W);
+			
+			lookup_native<T, I>(_samples, _window, _t + i, _count - i, _alpha + i, _delta + i, _W + i);
+		}
+		
+		/**
+		 * @brief Interpolates orientations at many epochs using AVX-512, however compiled.
+		 */
+		template<typename T, Interpolation I>
+		[[gnu::target("avx512f,avx512dq")]] static void lookup_avx512(const T* _samples, const std::array<T, 3U>& _window, const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const auto i = lookup_loop<SIMD::Vector<T, 128U / sizeof(T)>, I>(_samples, _window, _t, _count, _alpha, _delta, _W);
+			
+			lookup_native<T, I>(_samples, _window, _t + i, _count - i, _alpha + i, _delta + i, _W + i);
+		}
+#endif
+		
+		/**
+		 * @brief Interpolates orientations at many epochs, using the instruction set selected for the batched trigonometry.
+		 */
+		template<typename T, Interpolation I>
+		static void lookup_d(const T* _samples, const std::array<T, 3U>& _window, const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+
+#if defined(LOUIERIKSSON_WGCCRE_DISPATCH)
+			if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+				
+				switch (GetSinCos<T>().second) {
+					case InstructionSet::AVX512: { lookup_avx512<T, I>(_samples, _window, _t, _count, _alpha, _delta, _W); return; }
+					case InstructionSet::AVX2:   { lookup_avx2  <T, I>(_samples, _window, _t, _count, _alpha, _delta, _W); return; }
+					default:                     { break; }
+				}
+			}
+#endif
+			
+			lookup_native<T, I>(_samples, _window, _t, _count, _alpha, _delta, _W);
+		}
+
+		/**
+		 * @brief Evaluates the base polynomials of a model, excluding its periodic terms.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch.
+		 * @return The base orientation as alpha, delta and W (degrees).
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static constexpr std::array<T, 3U> EvaluateBase(const Model<T, A, N>& _model, const T& _t) {
+			
+			return {
+				_model.base[0].Evaluate(_t),
+				_model.base[1].Evaluate(_t),
+				_model.base[2].Evaluate(_t)
+			};
+		}
+		
+		/**
+		 * @brief Re-expresses a model as a function of the time elapsed since an epoch.
+		 *
+		 * @details Each polynomial is expanded about the epoch, and the constant terms of W and of every argument are
+		 * reduced modulo 360. This is done in the precision of the source model, so that a model converted to a narrower
+		 * type only ever multiplies its rates by small offsets.
+		 *
+		 * @param[in] _model The source model.
+		 * @param[in] _epoch The epoch to expand about.
+		 * @return The model as a function of the offset from \p _epoch.
+		 */
+		template<typename T, typename U, std::size_t A, std::size_t N>
+		static constexpr Model<T, A, N> Rebase(const Model<U, A, N>& _model, const U& _epoch) {
+			
+			const U d = _epoch * static_cast<U>(365250.0);
+			
+			const auto shift = [&](const Polynomial<U>& _p, const bool& _periodic) {
+				
+				const U c0 = _p.Evaluate(_epoch);
+				
+				return Polynomial<T> {
+					static_cast<T>(_periodic ? fmod_d(c0) : c0),
+					static_cast<T>(_p.t),
+					static_cast<T>(_p.d + (static_cast<U>(2.0) * _p.d2 * d)),
+					static_cast<T>(_p.d2)
+				};
+			};
+			
+			Model<T, A, N> result{};
+			
+			result.base[0] = shift(_model.base[0], false);
+			result.base[1] = shift(_model.base[1], false);
+			result.base[2] = shift(_model.base[2], true);
+			
+			for (std::size_t i = 0U; i < A; ++i) {
+				result.arguments[i] = shift(_model.arguments[i], true);
+			}
+			
+			for (std::size_t i = 0U; i < N; ++i) {
+				
+				const auto& term = _model.terms[i];
+				
+				result.terms[i] = { term.component, term.function, term.argument, static_cast<T>(term.amplitude) };
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns true if a set of components includes a component.
+		 */
+		static constexpr bool Includes(const Components& _set, const Component& _component) {
+			return ((static_cast<std::uint8_t>(_set) >> static_cast<std::uint8_t>(_component)) & 1U) != 0U;
+		}
+		
+		/**
+		 * @brief Counts the arguments and periodic terms of a model which contribute to a set of components.
+		 *
+		 * @param[in] _model The model.
+		 * @return The number of arguments and the number of terms, in that order.
+		 */
+		template<Components C, typename T, std::size_t A, std::size_t N>
+		static constexpr std::array<std::size_t, 2U> CountSelected(const Model<T, A, N>& _model) {
+			
+			std::array<bool, A> used{};
+			
+			std::size_t terms = 0U;
+			for (const auto& term : _model.terms) {
+				
+				if (Includes(C, term.component)) {
+					used[term.argument] = true;
+					
+					++terms;
+				}
+			}
+			
+			std::size_t arguments = 0U;
+			for (const auto& value : used) {
+				arguments += value ? 1U : 0U;
+			}
+			
+			return { arguments, terms };
+		}
+		
+		/**
+		 * @brief Reduces a model to the arguments and periodic terms contributing to a set of components.
+		 *
+		 * @details The base polynomials of excluded components are zeroed, and the remaining arguments renumbered.
+		 *
+		 * @tparam C The components to keep.
+		 * @tparam AC Number of arguments kept, as counted by CountSelected().
+		 * @tparam NC Number of terms kept, as counted by CountSelected().
+		 * @param[in] _model The source model.
+		 * @return The reduced model.
+		 */
+		template<Components C, std::size_t AC, std::size_t NC, typename T, std::size_t A, std::size_t N>
+		static constexpr Model<T, AC, NC> Select(const Model<T, A, N>& _model) {
+			
+			Model<T, AC, NC> result{};
+			
+			for (std::size_t k = 0U; k < 3U; ++k) {
+				
+				if (Includes(C, static_cast<Component>(k))) {
+					result.base[k] = _model.base[k];
+				}
+			}
+			
+			std::array<bool, A> used{};
+			for (const auto& term : _model.terms) {
+				
+				if (Includes(C, term.component)) {
+					used[term.argument] = true;
+				}
+			}
+			
+			std::array<std::uint8_t, A> index{};
+			
+			std::size_t arguments = 0U;
+			for (std::size_t i = 0U; i < A; ++i) {
+				
+				if (used[i]) {
+					index[i] = static_cast<std::uint8_t>(arguments);
+					
+					result.arguments[arguments++] = _model.arguments[i];
+				}
+			}
+			
+			std::size_t terms = 0U;
+			for (const auto& term : _model.terms) {
+				
+				if (Includes(C, term.component)) {
+					result.terms[terms++] = { term.component, term.function, index[term.argument], term.amplitude };
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Adds the periodic terms of a model to an orientation.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _sin Pointer to the sines of the model's arguments.
+		 * @param[in] _cos Pointer to the cosines of the model's arguments.
+		 * @param[in,out] _result The orientation to add the terms to.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static constexpr void ApplyTerms(const Model<T, A, N>& _model, const T* _sin, const T* _cos, std::array<T, 3U>& _result) {
+			
+			for (const auto& term : _model.terms) {
+				_result[static_cast<std::size_t>(term.component)] +=
+					term.amplitude * (term.function == Trig::Sin ? _sin[term.argument] : _cos[term.argument]);
+			}
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model at a single epoch.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees).
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static constexpr std::array<T, 3U> Evaluate(const Model<T, A, N>& _model, const T& _t) {
+			
+			auto result = EvaluateBase(_model, _t);
+			
+			if constexpr (A > 0U) {
+				
+				std::array<T, A> x{};
+				for (std::size_t i = 0U; i < A; ++i) {
+					x[i] = _model.arguments[i].Evaluate(_t);
+				}
+				
+				const auto [s, c] = sincos_d(x);
+				
+				ApplyTerms(_model, s.data(), c.data(), result);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model over many epochs, writing each component into its own array.
+		 *
+		 * @details Epochs are processed in blocks. Within a block, each argument is evaluated for every epoch and passed
+		 * through the sincos kernel together, so the trigonometry is vectorised across epochs rather than across terms.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta.
+		 * @param[out] _W Pointer to storage for \p _count values of W.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static void Evaluate(const Model<T, A, N>& _model, const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			EvaluateBlocks(_model, _t, _count, _alpha, _delta, _W, [](const Polynomial<T>& _p, const bool&, const T* _e, const std::size_t& _n, T* _out) {
+				
+				const T c0 = _p.c0, L = _p.Rate(), Q = _p.Acceleration();
+				
+				for (std::size_t j = 0U; j < _n; ++j) {
+					_out[j] = c0 + (_e[j] * (L + (_e[j] * Q)));
+				}
+			});
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model over many epochs in blocks, using a callable to evaluate its polynomials.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t Pointer to the first of \p _count epochs, of any representation accepted by \p _phase.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta.
+		 * @param[out] _W Pointer to storage for \p _count values of W.
+		 * @param[in] _phase Callable of the form <tt>(polynomial, periodic, epochs, count, out)</tt> writing the value of
+		 * the polynomial at each of \p count epochs.
+		 */
+		template<typename T, std::size_t A, std::size_t N, typename E, typename P>
+		static void EvaluateBlocks(const Model<T, A, N>& _model, const E* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W, const P& _phase) {
+			
+			constexpr std::size_t block = 64U;
+			
+			for (std::size_t i = 0U; i < _count; i += block) {
+				
+				const std::size_t n = std::min(block, _count - i);
+				
+				const E* t = _t + i;
+				
+				const std::array<T*, 3U> out { _alpha + i, _delta + i, _W + i };
+				
+				for (std::size_t k = 0U; k < 3U; ++k) {
+					_phase(_model.base[k], k == 2U, t, n, out[k]);
+				}
+				
+				for (std::size_t a = 0U; a < A; ++a) {
+					
+					std::array<T, block> x, s, c;
+					_phase(_model.arguments[a], true, t, n, x.data());
+					
+					sincos_d(x.data(), s.data(), c.data(), n);
+					
+					for (const auto& term : _model.terms) {
+						
+						if (term.argument == a) {
+							
+							const auto& y = term.function == Trig::Sin ? s : c;
+							
+							T* o = out[static_cast<std::size_t>(term.component)];
+							for (std::size_t j = 0U; j < n; ++j) {
+								o[j] += term.amplitude * y[j];
+							}
+						}
+					}
+				}
+			}
+		}
+		
+		/**
+		 * @brief Evaluates a polynomial at a split epoch.
+		 *
+		 * @details The product of the daily rate and the whole days is formed without error and reduced modulo 360
+		 * before the remaining, small contributions are added.
+		 *
+		 * @param[in] _p The polynomial.
+		 * @param[in] _t The epoch.
+		 * @param[in] _periodic Whether the polynomial is an angle that may be reduced modulo 360.
+		 * @return The value of the polynomial at the epoch, in [0, 360) if \p _periodic and the value is positive.
+		 */
+		template<typename T>
+		static constexpr T EvaluateSplit(const Polynomial<T>& _p, const SplitEpoch<T>& _t, const bool& _periodic) {
+			
+			T hi{}, lo{};
+			two_product(_p.d, _t.days, hi, lo);
+			
+			const T days = _t.days + _t.fraction;
+			
+			const T remainder = lo + (_p.d * _t.fraction) + (_p.t * (days / static_cast<T>(365250.0))) + (_p.d2 * (days * days));
+			
+			return _periodic ? fmod_d(_p.c0 + fmod_d(hi) + remainder) : (_p.c0 + hi) + remainder;
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model at a single split epoch.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees), with W reduced modulo 360.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static constexpr std::array<T, 3U> Evaluate(const Model<T, A, N>& _model, const SplitEpoch<T>& _t) {
+			
+			std::array<T, 3U> result {
+				EvaluateSplit(_model.base[0], _t, false),
+				EvaluateSplit(_model.base[1], _t, false),
+				EvaluateSplit(_model.base[2], _t, true)
+			};
+			
+			if constexpr (A > 0U) {
+				
+				std::array<T, A> x{};
+				for (std::size_t i = 0U; i < A; ++i) {
+					x[i] = EvaluateSplit(_model.arguments[i], _t, true);
+				}
+				
+				const auto [s, c] = sincos_d(x);
+				
+				ApplyTerms(_model, s.data(), c.data(), result);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model over many split epochs, writing each component into its own array.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta.
+		 * @param[out] _W Pointer to storage for \p _count values of W, reduced modulo 360.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static void Evaluate(const Model<T, A, N>& _model, const SplitEpoch<T>* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			EvaluateBlocks(_model, _t, _count, _alpha, _delta, _W, [](const Polynomial<T>& _p, const bool& _periodic, const SplitEpoch<T>* _e, const std::size_t& _n, T* _out) {
+				
+				for (std::size_t j = 0U; j < _n; ++j) {
+					_out[j] = EvaluateSplit(_p, _e[j], _periodic);
+				}
+			});
+		}
+		
+		/**
+		 * @brief Evaluates a polynomial at an epoch, for evaluators accepting either representation of the epoch.
+		 */
+		template<typename T>
+		static constexpr T EvaluatePhase(const Polynomial<T>& _p, const T& _t, const bool&) {
+			return _p.Evaluate(_t);
+		}
+		
+		/** @copydoc EvaluatePhase(const Polynomial<T>&, const T&, const bool&) */
+		template<typename T>
+		static constexpr T EvaluatePhase(const Polynomial<T>& _p, const SplitEpoch<T>& _t, const bool& _periodic) {
+			return EvaluateSplit(_p, _t, _periodic);
+		}
+		
+		/**
+		 * @brief Converts a split epoch to a single value, for terms insensitive to its precision.
+		 */
+		template<typename T>
+		static constexpr T Join(const SplitEpoch<T>& _t) {
+			return (_t.days + _t.fraction) / static_cast<T>(365250.0);
+		}
+		
+		/** @copydoc Join(const SplitEpoch<T>&) */
+		template<typename T>
+		static constexpr const T& Join(const T& _t) {
+			return _t;
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model and its derivative at a single epoch.
+		 *
+		 * @details The derivative of each periodic term reuses the sine and cosine of its argument.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch, either as a single value or a SplitEpoch.
+		 * @return The orientation and its rates of change.
+		 */
+		template<typename T, std::size_t A, std::size_t N, typename E>
+		static constexpr State<T> EvaluateState(const Model<T, A, N>& _model, const E& _t) {
+			
+			constexpr T D2R = static_cast<T>(3.14159265358979323846264338327950288L / 180.0L);
+			
+			const T t = Join(_t);
+			
+			State<T> result{};
+			
+			for (std::size_t k = 0U; k < 3U; ++k) {
+				result.value[k] = EvaluatePhase(_model.base[k], _t, k == 2U);
+				result.rate [k] = _model.base[k].Derivative(t);
+			}
+			
+			if constexpr (A > 0U) {
+				
+				std::array<T, A> x{}, dx{};
+				for (std::size_t i = 0U; i < A; ++i) {
+					x [i] = EvaluatePhase(_model.arguments[i], _t, true);
+					dx[i] = _model.arguments[i].Derivative(t) * D2R;
+				}
+				
+				const auto [s, c] = sincos_d(x);
+				
+				ApplyTerms(_model, s.data(), c.data(), result.value);
+				
+				for (const auto& term : _model.terms) {
+					
+					const auto a = term.argument;
+					
+					result.rate[static_cast<std::size_t>(term.component)] += term.amplitude * dx[a] *
+						(term.function == Trig::Sin ? c[a] : -s[a]);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Maps a runtime Body onto a compile-time one.
+		 *
+		 * @details A value outside of Body is a hard error: it fails to compile in a constant expression and aborts at
+		 * runtime, rather than evaluating some other body.
+		 *
+		 * @param[in] _body The body to dispatch on.
+		 * @param[in] _f Callable accepting a std::integral_constant<Body, ...> identifying the body.
+		 * @return The result of invoking \p _f.
+		 */
+		template<typename F>
+		static constexpr decltype(auto) Dispatch(const Body& _body, F&& _f) {
+			
+			switch (_body) {
+				case Body::Sol:       { return _f(std::integral_constant<Body, Body::Sol      >{}); }
+				case Body::Mercury:   { return _f(std::integral_constant<Body, Body::Mercury  >{}); }
+				case Body::Venus:     { return _f(std::integral_constant<Body, Body::Venus    >{}); }
+				case Body::Earth:     { return _f(std::integral_constant<Body, Body::Earth    >{}); }
+				case Body::Moon:      { return _f(std::integral_constant<Body, Body::Moon     >{}); }
+				case Body::Mars:      { return _f(std::integral_constant<Body, Body::Mars     >{}); }
+				case Body::Jupiter:   { return _f(std::integral_constant<Body, Body::Jupiter  >{}); }
+				case Body::Saturn:    { return _f(std::integral_constant<Body, Body::Saturn   >{}); }
+				case Body::Uranus:    { return _f(std::integral_constant<Body, Body::Uranus   >{}); }
+				case Body::Neptune:   { return _f(std::integral_constant<Body, Body::Neptune  >{}); }
+				case Body::Phobos:    { return _f(std::integral_constant<Body, Body::Phobos   >{}); }
+				case Body::Deimos:    { return _f(std::integral_constant<Body, Body::Deimos   >{}); }
+				case Body::Io:        { return _f(std::integral_constant<Body, Body::Io       >{}); }
+				case Body::Europa:    { return _f(std::integral_constant<Body, Body::Europa   >{}); }
+				case Body::Ganymede:  { return _f(std::integral_constant<Body, Body::Ganymede >{}); }
+				case Body::Callisto:  { return _f(std::integral_constant<Body, Body::Callisto >{}); }
+				case Body::Mimas:     { return _f(std::integral_constant<Body, Body::Mimas    >{}); }
+				case Body::Enceladus: { return _f(std::integral_constant<Body, Body::Enceladus>{}); }
+				case Body::Tethys:    { return _f(std::integral_constant<Body, Body::Tethys   >{}); }
+				case Body::Dione:     { return _f(std::integral_constant<Body, Body::Dione    >{}); }
+				case Body::Rhea:      { return _f(std::integral_constant<Body, Body::Rhea     >{}); }
+				case Body::Titan:     { return _f(std::integral_constant<Body, Body::Titan    >{}); }
+				default:              { std::abort(); }
+			}
+		}
+		
+		/**
+		 * @brief Returns the offsets added to delta, and to the sum of alpha and W, when converting to the VSOP87 frame.
+		 */
+		template<typename T>
+		static constexpr std::array<T, 2U> GetVSOP87Offsets() {
+			
+			// Values courtesy of stellarium: https://github.com/Stellarium/stellarium/blob/e57820ca6122fe4353d4d66dfa1104bd60e4deb5/src/core/StelCore.cpp#L59
+			const auto x_offset = static_cast<T>(90.0) - EarthAxialTilt<T>();
+			const auto y_offset = static_cast<T>(0.0000275);
+			
+			return { x_offset, y_offset - static_cast<T>(180.0) };
+		}
+		
+		template<typename T>
+		static constexpr std::array<T, 3U> ToVSOP87(const std::array<T, 3U>& _alpha_delta_W) {
+			
+			const auto ra = _alpha_delta_W[0];
+			const auto de = _alpha_delta_W[1];
+			
+			const auto correction = _alpha_delta_W[2];
+			
+			const auto offsets = GetVSOP87Offsets<T>();
+			
+			return {
+				fmod_d<T>(de + offsets[0]),
+				fmod_d<T>((ra + correction) + offsets[1]),
+				0
+			};
+		}
+		
+		/**
+		 * @brief Converts a rotational model to one evaluating directly in the VSOP87 frame.
+		 *
+		 * @details The conversion is linear in the components, so the offsets are folded into the constant terms and the
+		 * polynomials and terms of alpha and W merged. The first VSOP87 component is placed in alpha and the second in W,
+		 * which is reduced modulo 360 by the split evaluators, leaving delta zero. Only the final wrap remains to be done.
+		 *
+		 * @param[in] _model The source model.
+		 * @return The fused model.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static constexpr Model<T, A, N> ToVSOP87(const Model<T, A, N>& _model) {
+			
+			const auto offsets = GetVSOP87Offsets<T>();
+			
+			const auto& alpha = _model.base[0];
+			const auto& delta = _model.base[1];
+			const auto& W     = _model.base[2];
+			
+			Model<T, A, N> result{};
+			
+			result.base[0] = { delta.c0 + offsets[0], delta.t, delta.d, delta.d2 };
+			result.base[2] = { (alpha.c0 + W.c0) + offsets[1], alpha.t + W.t, alpha.d + W.d, alpha.d2 + W.d2 };
+			
+			result.arguments = _model.arguments;
+			
+			for (std::size_t i = 0U; i < N; ++i) {
+				
+				const auto& term = _model.terms[i];
+				
+				result.terms[i] = { term.component == Component::Delta ? Component::Alpha : Component::W, term.function, term.argument, term.amplitude };
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Wraps the output of a model converted with ToVSOP87() into a VSOP87 orientation.
+		 */
+		template<typename T>
+		static constexpr std::array<T, 3U> WrapVSOP87(const std::array<T, 3U>& _value) {
+			return { fmod_d(_value[0]), fmod_d(_value[2]), 0 };
+		}
+		
+		/**
+		 * @brief Evaluates a model converted with ToVSOP87() over many epochs, wrapping each block while it is in cache.
+		 *
+		 * @param[in] _model The fused model.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _x Pointer to storage for \p _count first VSOP87 components.
+		 * @param[out] _y Pointer to storage for \p _count second VSOP87 components.
+		 * @param[out] _z Pointer to storage for \p _count third VSOP87 components.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static void EvaluateVSOP87(const Model<T, A, N>& _model, const T* _t, const std::size_t& _count, T* _x, T* _y, T* _z) {
+			
+			constexpr std::size_t block = 64U;
+			
+			for (std::size_t i = 0U; i < _count; i += block) {
+				
+				const std::size_t n = std::min(block, _count - i);
+				
+				// The fused model evaluates the second component in the place of W, and leaves the place of delta zero.
+				Evaluate(_model, _t + i, n, _x + i, _z + i, _y + i);
+				
+				for (std::size_t j = i; j < i + n; ++j) {
+					_x[j] = fmod_d(_x[j]);
+					_y[j] = fmod_d(_y[j]);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Writes an orientation to a caller-owned type through its Output trait.
+		 */
+		template<typename R, typename T>
+		static constexpr void Write(R& _out, const std::array<T, 3U>& _value) {
+			Output<R>::Write(_out, _value[0], _value[1], _value[2]);
+		}
+		
+		/**
+		 * @brief Evaluates many orientations in blocks, writing each to a caller-owned type through its Output trait.
+		 *
+		 * @param[in] _count Number of orientations.
+		 * @param[out] _out Pointer to storage for \p _count orientations.
+		 * @param[in] _evaluate Callable of the form <tt>(offset, count, alpha, delta, W)</tt> writing \p count orientations,
+		 * starting from the epoch at \p offset, as separate components.
+		 */
+		template<typename T, typename R, typename F>
+		static void WriteBlocks(const std::size_t& _count, R* _out, const F& _evaluate) {
+			
+			constexpr std::size_t block = 64U;
+			
+			std::array<T, block> alpha{}, delta{}, W{};
+			
+			for (std::size_t i = 0U; i < _count; i += block) {
+				
+				const std::size_t n = std::min(block, _count - i);
+				
+				_evaluate(i, n, alpha.data(), delta.data(), W.data());
+				
+				for (std::size_t j = 0U; j < n; ++j) {
+					Output<R>::Write(_out[i + j], alpha[j], delta[j], W[j]);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Evaluates a set of bodies over the next epochs of an evenly-spaced range, into a reusable buffer.
+		 *
+		 * @param[in] _bodies The bodies, without repetition.
+		 * @param[in] _begin The first epoch of the range.
+		 * @param[in] _step The interval between epochs.
+		 * @param[in] _offset Index of the first epoch to evaluate.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[in,out] _buffer Storage for the epochs and orientations, grown as required.
+		 * @return A view of the epochs and orientations in \p _buffer.
+		 */
+		template<typename P, typename T>
+		static Batch<T> EvaluateBatch(const std::vector<Body>& _bodies, const T& _begin, const T& _step, const std::size_t& _offset, const std::size_t& _count, std::vector<T>& _buffer) {
+			
+			_buffer.resize(std::max(_buffer.size(), _count * (1U + (3U * _bodies.size()))));
+			
+			Batch<T> result { _offset, _count, _buffer.data(), {} };
+			
+			T* t = _buffer.data();
+			
+			// Multiply rather than accumulate the step, so that no error builds up over long ranges.
+			for (std::size_t i = 0U; i < _count; ++i) {
+				t[i] = _begin + (static_cast<T>(_offset + i) * _step);
+			}
+			
+			for (std::size_t b = 0U; b < _bodies.size(); ++b) {
+				
+				T* alpha = t     + ((1U + (3U * b)) * _count);
+				T* delta = alpha + _count;
+				T* W     = delta + _count;
+				
+				Dispatch(_bodies[b], [&](auto _b) { Registry<P>::template GetOrientation<decltype(_b)::value>(t, _count, alpha, delta, W); });
+				
+				result.values[static_cast<std::size_t>(_bodies[b])] = { alpha, delta, W };
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a set of bodies with any repetitions removed, keeping the first occurrence of each.
+		 */
+		static std::vector<Body> Unique(const std::vector<Body>& _bodies) {
+			
+			std::vector<Body> result;
+			result.reserve(_bodies.size());
+			
+			for (const auto& body : _bodies) {
+				
+				if (std::find(result.begin(), result.end(), body) == result.end()) {
+					result.push_back(body);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the rotational model used for a body.
+		 *
+		 * @details The report providing each body is chosen by a policy, which is DefaultReports unless another is given.
+		 *
+		 * @tparam B The body.
+		 * @tparam P The report policy, see Reports.
+		 * @return A reference to the model.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static constexpr const auto& GetModel() {
+			return P::template GetModel<B, T>();
+		}
+		
+		/**
+		 * @brief The rotational model of a body, reduced to the terms contributing to a set of components.
+		 */
+		template<Body B, Components C, typename T, typename P = DefaultReports>
+		static constexpr auto s_Selected = Select<C, CountSelected<C>(GetModel<B, T, P>())[0U], CountSelected<C>(GetModel<B, T, P>())[1U]>(GetModel<B, T, P>());
+		
+		/**
+		 * @brief The rotational model of a body, converted to evaluate directly in the VSOP87 frame.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static constexpr auto s_VSOP87 = ToVSOP87(GetModel<B, T, P>());
+		
+		/**
+		 * @brief Returns the body whose arguments a body's model shares.
+		 *
+		 * @details Satellites of the same planet are driven by one set of arguments, so only the first satellite of each system owns them.
+		 *
+		 * @tparam B The body.
+		 * @return The owning body, or \p B if its arguments are its own.
+		 */
+		template<Body B>
+		static constexpr Body GetArgumentOwner() {
+			
+			     if constexpr (B == Body::Deimos)                                                    { return Body::Phobos; }
+			else if constexpr (B == Body::Europa || B == Body::Ganymede || B == Body::Callisto) { return Body::Io;     }
+			else if constexpr (B == Body::Tethys || B == Body::Rhea)                            { return Body::Mimas;  }
+			else                                                                                 { return B;            }
+		}
+		
+		/**
+		 * @brief Returns the planet a body orbits.
+		 *
+		 * @tparam B The body.
+		 * @return The planet, or \p B if it is not a satellite.
+		 */
+		template<Body B>
+		static constexpr Body GetPrimary() {
+			
+			     if constexpr (B == Body::Moon)                                                      { return Body::Earth;   }
+			else if constexpr (B == Body::Phobos || B == Body::Deimos)                              { return Body::Mars;    }
+			else if constexpr (B >= Body::Io     && B <= Body::Callisto)                            { return Body::Jupiter; }
+			else if constexpr (B >= Body::Mimas  && B <= Body::Titan)                               { return Body::Saturn;  }
+			else                                                                                 { return B;             }
+		}
+		
+		/**
+		 * @brief Returns the satellite holding the arguments of a planet's system.
+		 *
+		 * @tparam P The planet.
+		 * @return The satellite, or \p P if the planet has no satellites.
+		 */
+		template<Body P>
+		static constexpr Body GetSystemOwner() {
+			
+			     if constexpr (P == Body::Earth  ) { return Body::Moon;   }
+			else if constexpr (P == Body::Mars   ) { return Body::Phobos; }
+			else if constexpr (P == Body::Jupiter) { return Body::Io;     }
+			else if constexpr (P == Body::Saturn ) { return Body::Mimas;  }
+			else                                   { return P;            }
+		}
+		
+		/**
+		 * @brief Checks whether two bodies' models share identical arguments.
+		 */
+		template<Body A, Body B, typename T, typename P = DefaultReports>
+		static constexpr bool SharesArguments() {
+			
+			const auto& a = GetModel<A, T, P>().arguments;
+			const auto& b = GetModel<B, T, P>().arguments;
+			
+			if (a.size() != b.size()) {
+				return false;
+			}
+			
+			for (std::size_t i = 0U; i < a.size(); ++i) {
+				
+				if (a[i].c0 != b[i].c0 || a[i].t != b[i].t || a[i].d != b[i].d || a[i].d2 != b[i].d2) {
+					return false;
+				}
+			}
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Returns the offset of each body's arguments within an array holding the arguments of every Body once.
+		 *
+		 * @details Only bodies owning their arguments are allotted any; the arguments of a satellite sharing those of
+		 * another start at its owner's offset. The final element is the total number of arguments.
+		 */
+		template<typename T, typename P, std::size_t... I>
+		static constexpr std::array<std::size_t, sizeof...(I) + 1U> GetArgumentOffsets(std::index_sequence<I...>) {
+			
+			static_assert((SharesArguments<static_cast<Body>(I), GetArgumentOwner<static_cast<Body>(I)>(), T, P>() && ...), "Satellites of a system must share their arguments.");
+			
+			constexpr std::array<std::size_t, sizeof...(I)> counts {
+				(GetArgumentOwner<static_cast<Body>(I)>() == static_cast<Body>(I) ? GetModel<static_cast<Body>(I), T, P>().arguments.size() : 0U)...
+			};
+			
+			std::array<std::size_t, sizeof...(I) + 1U> result{};
+			for (std::size_t i = 0U; i < counts.size(); ++i) {
+				result[i + 1U] = result[i] + counts[i];
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief The offsets returned by GetArgumentOffsets() for every Body.
+		 */
+		template<typename T, typename P = DefaultReports>
+		static constexpr auto s_ArgumentOffsets = GetArgumentOffsets<T, P>(std::make_index_sequence<s_BodyCount>{});
+		
+		/**
+		 * @brief Implementation of GetAllOrientations() over the underlying values of every Body.
+		 *
+		 * @details Each system's shared arguments are evaluated once, by their owner, and reused by the other satellites.
+		 */
+		template<typename T, typename P, std::size_t... I>
+		static constexpr Orientations<T> GetAllOrientations(const T& _t, std::index_sequence<I...>) {
+			
+			constexpr const auto& offsets = s_ArgumentOffsets<T, P>;
+			
+			std::array<T, offsets.back()> x{};
+			
+			const auto gather = [&](auto _i) {
+				
+				const auto& model = GetModel<static_cast<Body>(decltype(_i)::value), T, P>();
+				
+				for (std::size_t a = 0U; a < offsets[decltype(_i)::value + 1U] - offsets[decltype(_i)::value]; ++a) {
+					x[offsets[decltype(_i)::value] + a] = model.arguments[a].Evaluate(_t);
+				}
+			};
+			
+			(gather(std::integral_constant<std::size_t, I>{}), ...);
+			
+			const auto [s, c] = sincos_d(x);
+			
+			Orientations<T> result{};
+			
+			const auto apply = [&](auto _i) {
+				
+				const auto& model = GetModel<static_cast<Body>(decltype(_i)::value), T, P>();
+				
+				auto& value = result.values[decltype(_i)::value];
+				
+				value = EvaluateBase(model, _t);
+				
+				constexpr auto offset = offsets[static_cast<std::size_t>(GetArgumentOwner<static_cast<Body>(decltype(_i)::value)>())];
+				
+				ApplyTerms(model, s.data() + offset, c.data() + offset, value);
+			};
+			
+			(apply(std::integral_constant<std::size_t, I>{}), ...);
+			
+			return result;
+		}
+		
+	public:
+		
+		template <typename T>
+		static constexpr T EarthAxialTilt() {
+			return static_cast<T>(23.4392803055555555556L);
+		}
+		
+		/**
+		 * @brief Returns the instruction set the batched evaluations of \p T run on.
+		 *
+		 * @details The choice is made on first use, from the instruction sets supported by the running CPU where runtime
+		 * dispatch is enabled, and from those enabled at compile time otherwise.
+		 */
+		template<typename T = double>
+		static InstructionSet GetInstructionSet() {
+			return GetSinCos<T>().second;
+		}
+		
+		/**
+		 * @brief True if instrumentation is compiled in, i.e. LOUIERIKSSON_WGCCRE_STATS is defined.
+		 */
+		static constexpr bool s_StatisticsEnabled =
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+			true;
+#else
+			false;
+#endif
+		
+		/**
+		 * @brief A snapshot of the instrumentation counters.
+		 *
+		 * @details Per-body counters are indexed by the underlying value of the Body. Evaluations made at compile time are
+		 * not counted.
+		 */
+		struct Statistics final {
+			
+			/** @brief Single-epoch evaluations, including those made on behalf of a Cache, System or table. */
+			std::array<std::uint64_t, s_BodyCount> evaluations;
+			
+			/** @brief Calls to the batched evaluators. */
+			std::array<std::uint64_t, s_BodyCount> batches;
+			
+			/** @brief Epochs evaluated by the batched evaluators. */
+			std::array<std::uint64_t, s_BodyCount> batch_epochs;
+			
+			/** @brief Wall-clock time spent in the batched evaluators, summed across threads (nanoseconds). */
+			std::array<std::uint64_t, s_BodyCount> batch_nanoseconds;
+			
+			/** @brief Lookups answered by a Cache without evaluating. */
+			std::uint64_t cache_hits;
+			
+			/** @brief Lookups for which a Cache had to evaluate. */
+			std::uint64_t cache_misses;
+			
+			/** @brief Lookups of a Chebyshev approximation within its fitted window. */
+			std::uint64_t chebyshev_hits;
+			
+			/** @brief Lookups of a Chebyshev approximation outside of its fitted window, which are extrapolated. */
+			std::uint64_t chebyshev_misses;
+		};
+		
+		/**
+		 * @brief Returns a snapshot of the instrumentation counters.
+		 *
+		 * @details Counters are read individually, so a snapshot taken during evaluation may be mutually inconsistent by
+		 * the work in flight. All counters are zero unless LOUIERIKSSON_WGCCRE_STATS is defined.
+		 */
+		static Statistics GetStatistics() {
+			
+			Statistics result{};
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+			const auto& counters = GetCounters();
+			
+			for (std::size_t i = 0U; i < s_BodyCount; ++i) {
+				result.evaluations      [i] = counters.evaluations      [i].load(std::memory_order_relaxed);
+				result.batches          [i] = counters.batches          [i].load(std::memory_order_relaxed);
+				result.batch_epochs     [i] = counters.batch_epochs     [i].load(std::memory_order_relaxed);
+				result.batch_nanoseconds[i] = counters.batch_nanoseconds[i].load(std::memory_order_relaxed);
+			}
+			
+			result.cache_hits       = counters.cache_hits      .load(std::memory_order_relaxed);
+			result.cache_misses     = counters.cache_misses    .load(std::memory_order_relaxed);
+			result.chebyshev_hits   = counters.chebyshev_hits  .load(std::memory_order_relaxed);
+			result.chebyshev_misses = counters.chebyshev_misses.load(std::memory_order_relaxed);
+#endif
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Resets every instrumentation counter to zero.
+		 */
+		static void ResetStatistics() {
+
+#if defined(LOUIERIKSSON_WGCCRE_STATS)
+			auto& counters = GetCounters();
+			
+			for (std::size_t i = 0U; i < s_BodyCount; ++i) {
+				counters.evaluations      [i].store(0U, std::memory_order_relaxed);
+				counters.batches          [i].store(0U, std::memory_order_relaxed);
+				counters.batch_epochs     [i].store(0U, std::memory_order_relaxed);
+				counters.batch_nanoseconds[i].store(0U, std::memory_order_relaxed);
+			}
+			
+			counters.cache_hits      .store(0U, std::memory_order_relaxed);
+			counters.cache_misses    .store(0U, std::memory_order_relaxed);
+			counters.chebyshev_hits  .store(0U, std::memory_order_relaxed);
+			counters.chebyshev_misses.store(0U, std::memory_order_relaxed);
+#endif
+		}
+		
+		/**
+		 * @brief Resolves a body from its name.
+		 *
+		 * @details Intended to be called once, outside of any hot path, so that subsequent queries may use the Body overloads.
+		 *
+		 * @param[in] _name The name of the body, e.g. "Mars".
+		 * @return The matching Body, or an empty optional if the name is not recognised.
+		 */
+		static constexpr std::optional<Body> GetBody(const std::string_view& _name) {
+			
+			for (std::size_t i = 0U; i < s_BodyNames.size(); ++i) {
+				
+				if (s_BodyNames[i] == _name) {
+					return static_cast<Body>(i);
+				}
+			}
+			
+			return std::nullopt;
+		}
+		
+		/**
+		 * @brief Returns the name of a body.
+		 *
+		 * @param[in] _body The body.
+		 * @return The name of the body, e.g. "Mars", or an empty string if \p _body is not a valid Body.
+		 */
+		static constexpr std::string_view GetName(const Body& _body) {
+			
+			const auto index = static_cast<std::size_t>(_body);
+			
+			return index < s_BodyNames.size() ? s_BodyNames[index] : std::string_view {};
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body in the frame of the report it is sourced from.
+		 *
+		 * @details The body is selected at compile time, so no dispatch takes place.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body as alpha, delta and W (degrees).
+		 */
+		template<Body B, typename T>
+		static constexpr std::array<T, 3U> GetOrientation(const T& _t) {
+			
+			CountEvaluation(B);
+			
+			return Evaluate(GetModel<B, T>(), _t);
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientation() evaluating one body over many epochs.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta.
+		 * @param[out] _W Pointer to storage for \p _count values of W.
+		 */
+		template<Body B, typename T>
+		static void GetOrientation(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const BatchScope scope(B, _count);
+			
+			Evaluate(GetModel<B, T>(), _t, _count, _alpha, _delta, _W);
+		}
+		
+		/**
+		 * @brief Returns a subset of the components of a body's orientation, evaluating only the terms they require.
+		 *
+		 * @details Arguments and periodic terms contributing only to other components are removed at compile time. For
+		 * instance, <tt>GetOrientation<Body::Mars, Components::W></tt> evaluates none of the terms of the pole.
+		 *
+		 * @tparam B The body.
+		 * @tparam C The components to evaluate.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body as alpha, delta and W (degrees), with components outside of \p C set to zero.
+		 */
+		template<Body B, Components C, typename T>
+		static constexpr std::array<T, 3U> GetOrientation(const T& _t) {
+			
+			CountEvaluation(B);
+			
+			return Evaluate(s_Selected<B, C, T>, _t);
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientation() evaluating a subset of the components of one body.
+		 *
+		 * @tparam B The body.
+		 * @tparam C The components to evaluate.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha, or zeros if not in \p C.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta, or zeros if not in \p C.
+		 * @param[out] _W Pointer to storage for \p _count values of W, or zeros if not in \p C.
+		 */
+		template<Body B, Components C, typename T>
+		static void GetOrientation(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const BatchScope scope(B, _count);
+			
+			Evaluate(s_Selected<B, C, T>, _t, _count, _alpha, _delta, _W);
+		}
+		
+		/**
+		 * @brief Variant of GetOrientation() taking a split epoch, which retains full precision at large epochs.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body as alpha, delta and W (degrees), with W reduced modulo 360.
+		 */
+		template<Body B, typename T>
+		static constexpr std::array<T, 3U> GetOrientation(const SplitEpoch<T>& _t) {
+			
+			CountEvaluation(B);
+			
+			return Evaluate(GetModel<B, T>(), _t);
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientation() taking split epochs.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+		 * @param[out] _delta Pointer to storage for \p _count values of delta.
+		 * @param[out] _W Pointer to storage for \p _count values of W, reduced modulo 360.
+		 */
+		template<Body B, typename T>
+		static void GetOrientation(const SplitEpoch<T>* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+			
+			const BatchScope scope(B, _count);
+			
+			Evaluate(GetModel<B, T>(), _t, _count, _alpha, _delta, _W);
+		}
+		
+		/**
+		 * @brief Variant of GetOrientation() taking a split epoch and evaluating a subset of the components.
+		 *
+		 * @tparam B The body.
+		 * @tparam C The components to evaluate.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body as alpha, delta and W (degrees), with components outside of \p C set to zero.
+		 */
+		template<Body B, Components C, typename T>
+		static constexpr std::array<T, 3U> GetOrientation(const SplitEpoch<T>& _t) {
+			
+			CountEvaluation(B);
+			
+			return Evaluate(s_Selected<B, C, T>, _t);
+		}
+		
+		/**
+		 * @brief Variant of GetOrientation() writing the orientation directly into a caller-owned type.
+		 *
+		 * @tparam B The body.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t The epoch.
+		 * @param[out] _out The destination for alpha, delta and W (degrees).
+		 */
+		template<Body B, typename T, typename R>
+		static constexpr void GetOrientation(const T& _t, R& _out) {
+			Write(_out, GetOrientation<B>(_t));
+		}
+		
+		/**
+		 * @brief Variant of GetOrientation() taking a split epoch and writing directly into a caller-owned type.
+		 *
+		 * @tparam B The body.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t The epoch.
+		 * @param[out] _out The destination for alpha, delta and W (degrees), with W reduced modulo 360.
+		 */
+		template<Body B, typename T, typename R>
+		static constexpr void GetOrientation(const SplitEpoch<T>& _t, R& _out) {
+			Write(_out, GetOrientation<B>(_t));
+		}
+		
+		/**
+		 * @brief Variant of GetOrientation() evaluating a subset of the components and writing directly into a
+		 * caller-owned type.
+		 *
+		 * @tparam B The body.
+		 * @tparam C The components to evaluate.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t The epoch.
+		 * @param[out] _out The destination for alpha, delta and W (degrees), with components outside of \p C set to zero.
+		 */
+		template<Body B, Components C, typename T, typename R>
+		static constexpr void GetOrientation(const T& _t, R& _out) {
+			Write(_out, GetOrientation<B, C>(_t));
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientation() writing each orientation directly into a caller-owned type.
+		 *
+		 * @details Suited to arrays of vectors, such as staging buffers. For separate arrays of each component, use the
+		 * batched overload taking three output pointers.
+		 *
+		 * @tparam B The body.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _out Pointer to storage for \p _count orientations as alpha, delta and W (degrees).
+		 */
+		template<Body B, typename T, typename R>
+		static void GetOrientation(const T* _t, const std::size_t& _count, R* _out) {
+			
+			const BatchScope scope(B, _count);
+			
+			WriteBlocks<T>(_count, _out, [&](const std::size_t& _i, const std::size_t& _n, T* _alpha, T* _delta, T* _W) {
+				Evaluate(GetModel<B, T>(), _t + _i, _n, _alpha, _delta, _W);
+			});
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body together with its analytic rates of change.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees), and their rates in degrees per Julian millennium.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static constexpr State<T> GetState(const T& _t) {
+			
+			CountEvaluation(B);
+			
+			return EvaluateState(GetModel<B, T, P>(), _t);
+		}
+		
+		/**
+		 * @brief Variant of GetState() taking a split epoch.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation, with W reduced modulo 360, and its rates in degrees per Julian millennium.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static constexpr State<T> GetState(const SplitEpoch<T>& _t) {
+			
+			CountEvaluation(B);
+			
+			return EvaluateState(GetModel<B, T, P>(), _t);
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body together with its analytic rates of change.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees), and their rates in degrees per Julian millennium.
+		 */
+		template<typename T>
+		static constexpr State<T> GetState(const Body& _body, const T& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetState<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Variant of GetState() taking a split epoch.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation, with W reduced modulo 360, and its rates in degrees per Julian millennium.
+		 */
+		template<typename T>
+		static constexpr State<T> GetState(const Body& _body, const SplitEpoch<T>& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetState<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body for use with VSOP87, selecting the body at compile time.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame.
+		 */
+		template<Body B, typename T>
+		static constexpr std::array<T, 3U> GetOrientationVSOP87(const T& _t) {
+			
+			CountEvaluation(B);
+			
+			return WrapVSOP87(Evaluate(s_VSOP87<B, T>, _t));
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body for use with VSOP87.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame.
+		 */
+		template<typename T>
+		static constexpr std::array<T, 3U> GetOrientationVSOP87(const Body& _body, const T& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetOrientationVSOP87<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Variant of GetOrientationVSOP87() taking a split epoch, selecting the body at compile time.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame.
+		 */
+		template<Body B, typename T>
+		static constexpr std::array<T, 3U> GetOrientationVSOP87(const SplitEpoch<T>& _t) {
+			
+			CountEvaluation(B);
+			
+			return WrapVSOP87(Evaluate(s_VSOP87<B, T>, _t));
+		}
+		
+		/**
+		 * @brief Variant of GetOrientationVSOP87() taking a split epoch.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame.
+		 */
+		template<typename T>
+		static constexpr std::array<T, 3U> GetOrientationVSOP87(const Body& _body, const SplitEpoch<T>& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetOrientationVSOP87<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Variant of GetOrientationVSOP87() writing the orientation directly into a caller-owned type.
+		 *
+		 * @tparam B The body.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t The epoch.
+		 * @param[out] _out The destination for the orientation of the body in the VSOP87 frame.
+		 */
+		template<Body B, typename T, typename R>
+		static constexpr void GetOrientationVSOP87(const T& _t, R& _out) {
+			Write(_out, GetOrientationVSOP87<B>(_t));
+		}
+		
+		/**
+		 * @brief Variant of GetOrientationVSOP87() writing the orientation directly into a caller-owned type.
+		 *
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @param[out] _out The destination for the orientation of the body in the VSOP87 frame.
+		 */
+		template<typename T, typename R>
+		static constexpr void GetOrientationVSOP87(const Body& _body, const T& _t, R& _out) {
+			Dispatch(_body, [&](auto _b) { GetOrientationVSOP87<decltype(_b)::value>(_t, _out); });
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body for use with VSOP87, resolving the body by name.
+		 *
+		 * @note Prefer resolving the name once with GetBody() and calling the Body overloads on hot paths.
+		 *
+		 * @param[in] _name The name of the body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame, or an empty optional if the name is not recognised.
+		 */
+		template<typename T>
+		static constexpr std::optional<std::array<T, 3U>> TryGetOrientationVSOP87(const std::string_view& _name, const T& _t) {
+			
+			if (const auto body = GetBody(_name)) {
+				return GetOrientationVSOP87(*body, _t);
+			}
+			
+			return std::nullopt;
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body for use with VSOP87, resolving the body by name.
+		 *
+		 * @note Prefer resolving the name once with GetBody() and calling the Body overloads on hot paths, or
+		 * TryGetOrientationVSOP87() where unrecognised names must be detected.
+		 *
+		 * @param[in] _name The name of the body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation of the body in the VSOP87 frame. If the name is not recognised, the conversion of a zero
+		 * orientation.
+		 */
+		template<typename T>
+		static constexpr std::array<T, 3U> GetOrientationVSOP87(const std::string_view& _name, const T& _t) {
+			
+			if (const auto result = TryGetOrientationVSOP87(_name, _t)) {
+				return *result;
+			}
+			
+			return ToVSOP87(std::array<T, 3U>{});
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientationVSOP87() evaluating one body over many epochs.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _x Pointer to storage for \p _count first VSOP87 components.
+		 * @param[out] _y Pointer to storage for \p _count second VSOP87 components.
+		 * @param[out] _z Pointer to storage for \p _count third VSOP87 components.
+		 */
+		template<Body B, typename T>
+		static void GetOrientationVSOP87(const T* _t, const std::size_t& _count, T* _x, T* _y, T* _z) {
+			
+			const BatchScope scope(B, _count);
+			
+			EvaluateVSOP87(s_VSOP87<B, T>, _t, _count, _x, _y, _z);
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientationVSOP87() writing each orientation directly into a caller-owned type.
+		 *
+		 * @tparam B The body.
+		 * @tparam R The output type, written through Output<R>.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _out Pointer to storage for \p _count orientations in the VSOP87 frame.
+		 */
+		template<Body B, typename T, typename R>
+		static void GetOrientationVSOP87(const T* _t, const std::size_t& _count, R* _out) {
+			
+			const BatchScope scope(B, _count);
+			
+			WriteBlocks<T>(_count, _out, [&](const std::size_t& _i, const std::size_t& _n, T* _x, T* _y, T* _z) {
+				EvaluateVSOP87(s_VSOP87<B, T>, _t + _i, _n, _x, _y, _z);
+			});
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientationVSOP87() evaluating one body over many epochs.
+		 *
+		 * @details The body is dispatched once, after which every epoch is evaluated along the same path.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _x Pointer to storage for \p _count first VSOP87 components.
+		 * @param[out] _y Pointer to storage for \p _count second VSOP87 components.
+		 * @param[out] _z Pointer to storage for \p _count third VSOP87 components.
+		 */
+		template<typename T>
+		static void GetOrientationVSOP87(const Body& _body, const T* _t, const std::size_t& _count, T* _x, T* _y, T* _z) {
+			Dispatch(_body, [&](auto _b) { GetOrientationVSOP87<decltype(_b)::value>(_t, _count, _x, _y, _z); });
+		}
+		
+		/**
+		 * @brief Batched variant of GetOrientationVSOP87() evaluating one body over many epochs.
+		 *
+		 * @details The body is resolved from \p _name once, after which every epoch is evaluated along the same path.
+		 *
+		 * @param[in] _name The name of the body.
+		 * @param[in] _t Pointer to the first of \p _count epochs.
+		 * @param[in] _count Number of epochs to evaluate.
+		 * @param[out] _x Pointer to storage for \p _count first VSOP87 components.
+		 * @param[out] _y Pointer to storage for \p _count second VSOP87 components.
+		 * @param[out] _z Pointer to storage for \p _count third VSOP87 components.
+		 * @return True if the name was recognised. Otherwise, nothing is written.
+		 */
+		template<typename T>
+		static bool GetOrientationVSOP87(const std::string_view& _name, const T* _t, const std::size_t& _count, T* _x, T* _y, T* _z) {
+			
+			const auto body = GetBody(_name);
+			
+			if (body) {
+				GetOrientationVSOP87(*body, _t, _count, _x, _y, _z);
+			}
+			
+			return body.has_value();
+		}
+		
+		/**
+		 * @brief Returns the orientations of every Body at one epoch.
+		 *
+		 * @details The epoch is converted to days once. The arguments of every model are gathered into a single array
+		 * and evaluated with one pass of the sincos kernel, before the terms of each body are applied.
+		 *
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _t The epoch.
+		 * @return The orientations, indexed by Body.
+		 */
+		template<typename T, typename P = DefaultReports>
+		static constexpr Orientations<T> GetAllOrientations(const T& _t) {
+			
+			for (std::size_t i = 0U; i < s_BodyCount; ++i) {
+				CountEvaluation(static_cast<Body>(i));
+			}
+			
+			return GetAllOrientations<T, P>(_t, std::make_index_sequence<s_BodyNames.size()>{});
+		}
+		
+		/**
+		 * @brief Returns the orientations of every Body at one epoch, for use with VSOP87.
+		 *
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _t The epoch.
+		 * @return The orientations in the VSOP87 frame, indexed by Body.
+		 */
+		template<typename T, typename P = DefaultReports>
+		static constexpr Orientations<T> GetAllOrientationsVSOP87(const T& _t) {
+			
+			auto result = GetAllOrientations<T, P>(_t);
+			
+			for (auto& value : result.values) {
+				value = ToVSOP87(value);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Evaluates a set of bodies over an evenly-spaced range of epochs, dividing the range between threads.
+		 *
+		 * @details Each thread is assigned a contiguous run of epochs, which it evaluates in fixed-size blocks using the
+		 * batched evaluators, writing directly into the caller's buffer. No memory is allocated per epoch.
+		 *
+		 * The output is laid out as one array of \p _count values per body and component, i.e. component \p c of body
+		 * \p b at epoch \p i is written to <tt>_out[(((b * 3) + c) * _count) + i]</tt>, where alpha, delta and W are
+		 * components 0, 1 and 2.
+		 *
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _bodies Pointer to the first of \p _body_count bodies to evaluate.
+		 * @param[in] _body_count Number of bodies.
+		 * @param[in] _begin The first epoch.
+		 * @param[in] _step The interval between epochs.
+		 * @param[in] _count Number of epochs.
+		 * @param[out] _out Pointer to storage for <tt>_body_count * 3 * _count</tt> values.
+		 * @param[in] _threads Number of threads to use, or zero to use one per hardware thread.
+		 */
+		template<typename T, typename P = DefaultReports>
+		static void Generate(const Body* _bodies, const std::size_t& _body_count, const T& _begin, const T& _step, const std::size_t& _count, T* _out, const std::size_t& _threads = 0U) {
+			
+			const auto work = [&](const std::size_t& _first, const std::size_t& _last) {
+				
+				constexpr std::size_t block = 256U;
+				
+				std::array<T, block> t;
+				
+				for (std::size_t i = _first; i < _last; i += block) {
+					
+					const std::size_t n = std::min(block, _last - i);
+					
+					for (std::size_t j = 0U; j < n; ++j) {
+						t[j] = _begin + (static_cast<T>(i + j) * _step);
+					}
+					
+					for (std::size_t b = 0U; b < _body_count; ++b) {
+						
+						T* out = _out + (b * 3U * _count) + i;
+						
+						Dispatch(_bodies[b], [&](auto _b) {
+							Registry<P>::template GetOrientation<decltype(_b)::value>(t.data(), n, out, out + _count, out + (2U * _count));
+						});
+					}
+				}
+			};
+			
+			const std::size_t threads = std::max<std::size_t>(std::min<std::size_t>(
+				_threads == 0U ? static_cast<std::size_t>(std::thread::hardware_concurrency()) : _threads, _count), 1U);
+			
+			if (threads == 1U) {
+				work(0U, _count);
+			}
+			else {
+				
+				// Joins every thread started so far on leaving scope, so that an exception thrown while starting the threads
+				// or by the calling thread's share of the work never destroys a joinable thread.
+				struct Pool final {
+					
+					std::vector<std::thread> threads;
+					
+					~Pool() {
+						
+						for (auto& thread : threads) {
+							
+							if (thread.joinable()) {
+								thread.join();
+							}
+						}
+					}
+					
+				} pool;
+				
+				pool.threads.reserve(threads - 1U);
+				
+				const std::size_t chunk = (_count + threads - 1U) / threads;
+				
+				for (std::size_t i = 1U; i < threads; ++i) {
+					
+					const std::size_t first = std::min(i * chunk, _count);
+					const std::size_t last  = std::min(first + chunk, _count);
+					
+					pool.threads.emplace_back(work, first, last);
+				}
+				
+				// The calling thread takes the first chunk.
+				work(0U, std::min(chunk, _count));
+			}
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model term by term using the standard library's trigonometry.
+		 *
+		 * @details Shares no work between terms and takes none of the fast paths, making it suitable as a reference when
+		 * validating changes to the kernels or evaluators.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees).
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		static std::array<T, 3U> EvaluateReference(const Model<T, A, N>& _model, const T& _t) {
+			
+			constexpr T D2R = static_cast<T>(3.14159265358979323846264338327950288L / 180.0L);
+			
+			auto result = EvaluateBase(_model, _t);
+			
+			for (const auto& term : _model.terms) {
+				
+				const T x = std::fmod(_model.arguments[term.argument].Evaluate(_t), static_cast<T>(360.0)) * D2R;
+				
+				result[static_cast<std::size_t>(term.component)] +=
+					term.amplitude * (term.function == Trig::Sin ? std::sin(x) : std::cos(x));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a reference orientation of a body, evaluated term by term in long double.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees).
+		 */
+		template<Body B, typename T>
+		static std::array<T, 3U> GetReferenceOrientation(const T& _t) {
+			
+			const auto result = EvaluateReference(GetModel<B, long double>(), static_cast<long double>(_t));
+			
+			return { static_cast<T>(result[0]), static_cast<T>(result[1]), static_cast<T>(result[2]) };
+		}
+		
+		/**
+		 * @brief Measures the error of GetOrientation() against GetReferenceOrientation() over a range of epochs.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _begin The first epoch.
+		 * @param[in] _end The last epoch.
+		 * @param[in] _samples Number of evenly-spaced epochs to compare at.
+		 * @return The largest absolute error found in alpha, delta and W (degrees).
+		 */
+		template<Body B, typename T>
+		static std::array<T, 3U> GetMaxError(const T& _begin, const T& _end, const std::size_t& _samples) {
+			
+			std::array<long double, 3U> result{};
+			
+			for (std::size_t i = 0U; i < _samples; ++i) {
+				
+				const T t = _samples > 1U ?
+					_begin + ((_end - _begin) * static_cast<T>(i) / static_cast<T>(_samples - 1U)) :
+					_begin;
+				
+				const auto actual   = GetOrientation<B>(t);
+				const auto expected = EvaluateReference(GetModel<B, long double>(), static_cast<long double>(t));
+				
+				for (std::size_t c = 0U; c < 3U; ++c) {
+					result[c] = std::max(result[c], std::abs(static_cast<long double>(actual[c]) - expected[c]));
+				}
+			}
+			
+			return { static_cast<T>(result[0]), static_cast<T>(result[1]), static_cast<T>(result[2]) };
+		}
+		
+		/**
+		 * @brief Estimates the largest error of evaluating a body at an epoch in a tier of precision.
+		 *
+		 * @details The bound is a small multiple of the unit roundoff of the tier, scaled by the magnitude of every
+		 * polynomial of the model at the epoch, with the contribution of each argument weighted by the amplitudes of its
+		 * terms. Split tiers only see the magnitude left after the whole days are reduced. The bound describes the arithmetic
+		 * of the evaluation; it does not cover the accuracy of the model itself.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _precision The tier.
+		 * @param[in] _t The epoch.
+		 * @return The estimated bound on the absolute error of alpha, delta and W (degrees), with W taken modulo 360.
+		 */
+		template<Body B>
+		static constexpr double GetErrorBound(const Precision& _precision, const SplitEpoch<double>& _t) {
+			
+			constexpr double D2R = 3.14159265358979323846264338327950288 / 180.0;
+			
+			const double days = _t.days + _t.fraction;
+			const double t    = days / 365250.0;
+			
+			const bool split = _precision >= Precision::Split;
+			
+			double u = std::numeric_limits<double>::epsilon() / 2.0;
+			
+			switch (_precision) {
+				case Precision::Float:    { u = static_cast<double>(std::numeric_limits<float>::epsilon())       / 2.0; break; }
+				case Precision::Extended: { u = static_cast<double>(std::numeric_limits<long double>::epsilon()) / 2.0; break; }
+				case Precision::Quadruple: {
+#if defined(__SIZEOF_FLOAT128__) && !defined(__STRICT_ANSI__)
+					u = 0x1p-113;
+#else
+					return std::numeric_limits<double>::infinity();
+#endif
+					break;
+				}
+				default: { break; }
+			}
+			
+			const auto abs = [](const double& _x) { return _x < 0.0 ? -_x : _x; };
+			
+			const auto magnitude = [&](const Polynomial<double>& _p) {
+				
+				return split ?
+					720.0 + abs(_p.d * _t.fraction) + abs(_p.t * t) + abs(_p.d2 * days * days) :
+					abs(_p.c0) + abs(_p.Rate() * t) + abs(_p.Acceleration() * t * t);
+			};
+			
+			const auto& model = GetModel<B, double>();
+			
+			double result = 360.0;
+			for (const auto& p : model.base) {
+				result = std::max(result, magnitude(p));
+			}
+			
+			for (const auto& term : model.terms) {
+				result += abs(term.amplitude) * (1.0 + (D2R * magnitude(model.arguments[term.argument])));
+			}
+			
+			return 8.0 * u * result;
+		}
+		
+		/**
+		 * @brief Selects the cheapest tier of precision whose error bound at an epoch is within a tolerance.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @param[in] _tolerance The largest acceptable absolute error (degrees).
+		 * @return The tier, or an empty optional if no tier is accurate enough.
+		 */
+		template<Body B>
+		static constexpr std::optional<Precision> SelectPrecision(const SplitEpoch<double>& _t, const double& _tolerance) {
+			
+			for (const auto precision : { Precision::Float, Precision::Double, Precision::Split, Precision::Extended, Precision::Quadruple }) {
+				
+				if (GetErrorBound<B>(precision, _t) <= _tolerance) {
+					return precision;
+				}
+			}
+			
+			return std::nullopt;
+		}
+		
+		/**
+		 * @brief Returns the orientation of a body to within a tolerance, evaluating it in the cheapest sufficient tier.
+		 *
+		 * @details The tier is chosen by SelectPrecision(), taking into account the rounding of the result to \p T.
+		 * Nothing is evaluated if no tier meets the tolerance.
+		 *
+		 * @tparam B The body.
+		 * @tparam T The scalar type of the result.
+		 * @param[in] _t The epoch.
+		 * @param[in] _tolerance The largest acceptable absolute error (degrees).
+		 * @return The orientation as alpha, delta and W (degrees), with W reduced modulo 360, or an empty optional if the
+		 * tolerance cannot be met.
+		 */
+		template<Body B, typename T = double>
+		static constexpr std::optional<std::array<T, 3U>> GetOrientationWithin(const SplitEpoch<double>& _t, const double& _tolerance) {
+			
+			// Rounding the result, which is at most 360 in magnitude, to T.
+			const double rounding = 360.0 * static_cast<double>(std::numeric_limits<T>::epsilon()) / 2.0;
+			
+			const auto precision = SelectPrecision<B>(_t, _tolerance - rounding);
+			
+			if (!precision) {
+				return std::nullopt;
+			}
+			
+			const auto narrow = [](const auto& _value) {
+				
+				using U = std::decay_t<decltype(_value[0])>;
+				
+				return std::array<T, 3U> {
+					static_cast<T>(_value[0]),
+					static_cast<T>(_value[1]),
+					static_cast<T>(fmod_d<U>(_value[2]))
+				};
+			};
+			
+			switch (*precision) {
+				case Precision::Float:  { return narrow(GetOrientation<B>(static_cast<float>(Join(_t)))); }
+				case Precision::Double: { return narrow(GetOrientation<B>(Join(_t))); }
+				case Precision::Split:  { return narrow(GetOrientation<B>(_t)); }
+#if defined(__SIZEOF_FLOAT128__) && !defined(__STRICT_ANSI__)
+				case Precision::Quadruple: {
+					return narrow(GetOrientation<B>(SplitEpoch<__float128> {
+						static_cast<__float128>(_t.days),
+						static_cast<__float128>(_t.fraction)
+					}));
+				}
+#endif
+				case Precision::Extended:
+				default: {
+					return narrow(GetOrientation<B>(SplitEpoch<long double> {
+						static_cast<long double>(_t.days),
+						static_cast<long double>(_t.fraction)
+					}));
+				}
+			}
+		}
+		
+		/**
+		 * @brief Converts an orientation into the rotation matrix from the ICRF to the body-fixed frame.
+		 *
+		 * @details The matrix is Rz(W) * Rx(90 - delta) * Rz(90 + alpha), built from a single sincos evaluation of the
+		 * three angles. Its last row is the north pole of the body.
+		 *
+		 * @param[in] _alpha_delta_W The orientation as alpha, delta and W (degrees).
+		 * @return The row-major rotation matrix.
+		 */
+		template<typename T>
+		static std::array<std::array<T, 3U>, 3U> ToMatrix(const std::array<T, 3U>& _alpha_delta_W) {
+			
+			const auto [s, c] = sincos_d(_alpha_delta_W);
+			
+			const T sa = s[0], ca = c[0],
+			        sd = s[1], cd = c[1],
+			        sw = s[2], cw = c[2];
+			
+			return {{
+				{ -(sa * cw) - (ca * sd * sw),  (ca * cw) - (sa * sd * sw), cd * sw },
+				{  (sa * sw) - (ca * sd * cw), -(ca * sw) - (sa * sd * cw), cd * cw },
+				{   ca * cd,                     sa * cd,                   sd      }
+			}};
+		}
+		
+		/**
+		 * @brief Converts an orientation into the unit quaternion rotating from the ICRF to the body-fixed frame.
+		 *
+		 * @details The quaternion is equivalent to ToMatrix(), composed directly from the half-angles of its three
+		 * elementary rotations using a single sincos evaluation.
+		 *
+		 * @param[in] _alpha_delta_W The orientation as alpha, delta and W (degrees).
+		 * @return The quaternion as w, x, y and z.
+		 */
+		template<typename T>
+		static std::array<T, 4U> ToQuaternion(const std::array<T, 3U>& _alpha_delta_W) {
+			
+			const auto [s, c] = sincos_d(std::array<T, 3U> {
+				static_cast<T>(0.5) * (static_cast<T>(90.0) + _alpha_delta_W[0]),
+				static_cast<T>(0.5) * (static_cast<T>(90.0) - _alpha_delta_W[1]),
+				static_cast<T>(0.5) *  _alpha_delta_W[2]
+			});
+			
+			// qz(W) * qx(90 - delta) * qz(90 + alpha), where a change of frame by θ is an active rotation by -θ.
+			const T sa = s[0], ca = c[0],
+			        sd = s[1], cd = c[1],
+			        sw = s[2], cw = c[2];
+			
+			return {
+				 (cw * cd * ca) - (sw * cd * sa),
+				-(cw * sd * ca) - (sw * sd * sa),
+				 (sw * sd * ca) - (cw * sd * sa),
+				-(sw * cd * ca) - (cw * cd * sa)
+			};
+		}
+		
+		/**
+		 * @brief Converts an orientation into the unit vector of the body's north pole in the ICRF.
+		 *
+		 * @param[in] _alpha_delta_W The orientation as alpha, delta and W (degrees).
+		 * @return The pole vector.
+		 */
+		template<typename T>
+		static std::array<T, 3U> ToPole(const std::array<T, 3U>& _alpha_delta_W) {
+			
+			const auto [s, c] = sincos_d(std::array<T, 2U> { _alpha_delta_W[0], _alpha_delta_W[1] });
+			
+			return { c[0] * c[1], s[0] * c[1], s[1] };
+		}
+		
+		/**
+		 * @brief Returns the rotation matrix from the ICRF to the body-fixed frame of a body.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The row-major rotation matrix.
+		 */
+		template<Body B, typename T>
+		static std::array<std::array<T, 3U>, 3U> GetMatrix(const T& _t) {
+			return ToMatrix(GetOrientation<B>(_t));
+		}
+		
+		/**
+		 * @brief Returns the rotation matrix from the ICRF to the body-fixed frame of a body.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The row-major rotation matrix.
+		 */
+		template<typename T>
+		static std::array<std::array<T, 3U>, 3U> GetMatrix(const Body& _body, const T& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetMatrix<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Returns the unit quaternion rotating from the ICRF to the body-fixed frame of a body.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The quaternion as w, x, y and z.
+		 */
+		template<Body B, typename T>
+		static std::array<T, 4U> GetQuaternion(const T& _t) {
+			return ToQuaternion(GetOrientation<B>(_t));
+		}
+		
+		/**
+		 * @brief Returns the unit quaternion rotating from the ICRF to the body-fixed frame of a body.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The quaternion as w, x, y and z.
+		 */
+		template<typename T>
+		static std::array<T, 4U> GetQuaternion(const Body& _body, const T& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetQuaternion<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Returns the unit vector of a body's north pole in the ICRF.
+		 *
+		 * @tparam B The body.
+		 * @param[in] _t The epoch.
+		 * @return The pole vector.
+		 */
+		template<Body B, typename T>
+		static std::array<T, 3U> GetPole(const T& _t) {
+			return ToPole(GetOrientation<B>(_t));
+		}
+		
+		/**
+		 * @brief Returns the unit vector of a body's north pole in the ICRF.
+		 *
+		 * @param[in] _body The body.
+		 * @param[in] _t The epoch.
+		 * @return The pole vector.
+		 */
+		template<typename T>
+		static std::array<T, 3U> GetPole(const Body& _body, const T& _t) {
+			return Dispatch(_body, [&](auto _b) { return GetPole<decltype(_b)::value>(_t); });
+		}
+		
+		/**
+		 * @brief Evaluates a rotational model at a sequence of evenly-spaced epochs.
+		 *
+		 * @details Rather than evaluating the trigonometry of every argument at every step, the sine and cosine of each
+		 * argument are held as a unit phasor and advanced with the angle-addition identities, costing a few multiply-adds
+		 * per argument per step. Since each argument is at most quadratic in the epoch, its per-step increment is itself
+		 * a phasor advanced by a constant rotation. Accumulated rounding error is discarded by re-evaluating the phasors
+		 * exactly every \p _interval steps.
+		 *
+		 * @tparam A Number of arguments of the model.
+		 * @tparam N Number of periodic terms of the model.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		class Stepper final {
+		
+		private:
+			
+			const Model<T, A, N>* m_Model;
+			
+			T m_Start, m_Step;
+			
+			std::size_t m_Index, m_Interval;
+			
+			/** @brief Current phasor, per-step increment phasor, and constant rotation of the increment, per argument. */
+			std::array<T, A> m_Sin, m_Cos, m_SinStep, m_CosStep, m_SinAccel, m_CosAccel;
+			
+			void Synchronise() {
+				
+				if constexpr (A > 0U) {
+					
+					const T t = Epoch();
+					
+					std::array<T, A> x{}, dx{};
+					for (std::size_t i = 0U; i < A; ++i) {
+						
+						const auto& argument = m_Model->arguments[i];
+						
+						// φ(t) = c0 + (L * t) + (Q * t^2).
+						const T L = argument.Rate();
+						const T Q = argument.Acceleration();
+						
+						x[i]  = argument.Evaluate(t);
+						dx[i] = (L * m_Step) + (Q * ((static_cast<T>(2.0) * t * m_Step) + (m_Step * m_Step)));
+					}
+					
+					sincos_d(x.data(),  m_Sin.data(),     m_Cos.data(),     A);
+					sincos_d(dx.data(), m_SinStep.data(), m_CosStep.data(), A);
+				}
+			}
+			
+		public:
+			
+			/**
+			 * @brief Creates a stepper positioned at its first epoch.
+			 *
+			 * @param[in] _model The model. Must outlive the stepper.
+			 * @param[in] _t The first epoch.
+			 * @param[in] _dt The interval between epochs.
+			 * @param[in] _interval Number of steps between exact re-evaluations of the phasors.
+			 */
+			Stepper(const Model<T, A, N>& _model, const T& _t, const T& _dt, const std::size_t& _interval = 256U) :
+				m_Model(&_model),
+				m_Start(_t),
+				m_Step(_dt),
+				m_Index(0U),
+				m_Interval(std::max<std::size_t>(_interval, 1U)),
+				m_Sin{},
+				m_Cos{},
+				m_SinStep{},
+				m_CosStep{},
+				m_SinAccel{},
+				m_CosAccel{}
+			{
+				if constexpr (A > 0U) {
+					
+					std::array<T, A> ddx{};
+					for (std::size_t i = 0U; i < A; ++i) {
+						ddx[i] = static_cast<T>(2.0) * m_Model->arguments[i].Acceleration() * m_Step * m_Step;
+					}
+					
+					sincos_d(ddx.data(), m_SinAccel.data(), m_CosAccel.data(), A);
+				}
+				
+				Synchronise();
+			}
+			
+			/**
+			 * @brief Returns the current epoch.
+			 */
+			[[nodiscard]] T Epoch() const {
+				return m_Start + (static_cast<T>(m_Index) * m_Step);
+			}
+			
+			/**
+			 * @brief Returns the orientation at the current epoch.
+			 *
+			 * @return The orientation as alpha, delta and W (degrees).
+			 */
+			[[nodiscard]] std::array<T, 3U> Get() const {
+				
+				auto result = EvaluateBase(*m_Model, Epoch());
+				
+				ApplyTerms(*m_Model, m_Sin.data(), m_Cos.data(), result);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Advances to the next epoch.
+			 */
+			void Step() {
+				
+				if (++m_Index % m_Interval == 0U) {
+					Synchronise();
+				}
+				else {
+					
+					for (std::size_t i = 0U; i < A; ++i) {
+						
+						const T s = m_Sin[i], c = m_Cos[i];
+						
+						m_Sin[i] = (s * m_CosStep[i]) + (c * m_SinStep[i]);
+						m_Cos[i] = (c * m_CosStep[i]) - (s * m_SinStep[i]);
+						
+						const T ss = m_SinStep[i], cs = m_CosStep[i];
+						
+						m_SinStep[i] = (ss * m_CosAccel[i]) + (cs * m_SinAccel[i]);
+						m_CosStep[i] = (cs * m_CosAccel[i]) - (ss * m_SinAccel[i]);
+					}
+				}
+			}
+		};
+		
+		/**
+		 * @brief Creates a Stepper for a body.
+		 *
+		 * @tparam B The body.
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _t The first epoch.
+		 * @param[in] _dt The interval between epochs.
+		 * @param[in] _interval Number of steps between exact re-evaluations of the phasors.
+		 * @return A stepper positioned at \p _t.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static auto GetStepper(const T& _t, const T& _dt, const std::size_t& _interval = 256U) {
+			return Stepper(GetModel<B, T, P>(), _t, _dt, _interval);
+		}
+		
+		/**
+		 * @brief Serves orientations within a window of epochs from piecewise Chebyshev approximations.
+		 *
+		 * @details The window is divided into equal segments, and each component is fitted per segment with a Chebyshev
+		 * series of \p K coefficients. The fit is validated against the source function at points between the fitting
+		 * nodes, with the segments halved until the tolerance is met or the segment limit is reached. Queries then cost
+		 * one segment lookup and a Clenshaw recurrence per component, independent of the number of terms in the model.
+		 *
+		 * @note Queries outside of the window are extrapolated from the nearest segment.
+		 *
+		 * @tparam K Number of Chebyshev coefficients per segment and component.
+		 */
+		template<typename T, std::size_t K = 12U>
+		class Chebyshev final {
+		
+		private:
+			
+			using Segment = std::array<std::array<T, K>, 3U>;
+			
+			T m_Begin, m_Width, m_Error;
+			
+			std::vector<Segment> m_Segments;
+			
+			template<typename F>
+			static Segment Fit(const F& _f, const T& _begin, const T& _end) {
+				
+				constexpr T pi = static_cast<T>(3.14159265358979323846264338327950288L);
+				
+				const T mid  = static_cast<T>(0.5) * (_end + _begin);
+				const T half = static_cast<T>(0.5) * (_end - _begin);
+				
+				// Fit relative to the centre of the segment, so that large components such as W do not lose precision.
+				const auto centre = _f(mid);
+				
+				std::array<std::array<T, 3U>, K> samples{};
+				for (std::size_t j = 0U; j < K; ++j) {
+					
+					samples[j] = _f(mid + (half * std::cos(pi * (static_cast<T>(j) + static_cast<T>(0.5)) / static_cast<T>(K))));
+					
+					for (std::size_t c = 0U; c < 3U; ++c) {
+						samples[j][c] -= centre[c];
+					}
+				}
+				
+				Segment result{};
+				for (std::size_t k = 0U; k < K; ++k) {
+					for (std::size_t j = 0U; j < K; ++j) {
+						
+						const T weight = std::cos(pi * static_cast<T>(k) * (static_cast<T>(j) + static_cast<T>(0.5)) / static_cast<T>(K));
+						
+						for (std::size_t c = 0U; c < 3U; ++c) {
+							result[c][k] += samples[j][c] * weight;
+						}
+					}
+					
+					for (std::size_t c = 0U; c < 3U; ++c) {
+						result[c][k] *= static_cast<T>(2.0) / static_cast<T>(K);
+					}
+				}
+				
+				for (std::size_t c = 0U; c < 3U; ++c) {
+					result[c][0] += static_cast<T>(2.0) * centre[c];
+				}
+				
+				return result;
+			}
+			
+			static T Clenshaw(const std::array<T, K>& _c, const T& _u) {
+				
+				T b1{}, b2{};
+				
+				for (std::size_t k = K - 1U; k > 0U; --k) {
+					
+					const T b0 = (static_cast<T>(2.0) * _u * b1) - b2 + _c[k];
+					
+					b2 = b1;
+					b1 = b0;
+				}
+				
+				return (_u * b1) - b2 + (static_cast<T>(0.5) * _c[0]);
+			}
+			
+			/**
+			 * @brief Evaluates the approximation at an epoch without counting towards the statistics.
+			 */
+			[[nodiscard]] std::array<T, 3U> Interpolate(const T& _t) const {
+				
+				const T x = (_t - m_Begin) / m_Width;
+				
+				const auto i = static_cast<std::size_t>(std::clamp(std::floor(x), static_cast<T>(0.0), static_cast<T>(m_Segments.size() - 1U)));
+				
+				const T u = (static_cast<T>(2.0) * (x - static_cast<T>(i))) - static_cast<T>(1.0);
+				
+				const auto& segment = m_Segments[i];
+				
+				return {
+					Clenshaw(segment[0], u),
+					Clenshaw(segment[1], u),
+					Clenshaw(segment[2], u)
+				};
+			}
+			
+			/**
+			 * @brief Fits every segment, returning the largest error found when validating against \p _f.
+			 */
+			template<typename F>
+			T Build(const F& _f, const std::size_t& _count) {
+				
+				T error{};
+				
+				m_Segments.resize(_count);
+				
+				for (std::size_t i = 0U; i < _count; ++i) {
+					
+					const T a = m_Begin + (static_cast<T>(i) * m_Width);
+					
+					m_Segments[i] = Fit(_f, a, a + m_Width);
+				}
+				
+				for (std::size_t i = 0U; i < _count; ++i) {
+					
+					const T a = m_Begin + (static_cast<T>(i) * m_Width);
+					
+					// Validate between the fitting nodes, where the error of the approximation peaks.
+					for (std::size_t j = 0U; j <= 2U * K; ++j) {
+						
+						const T t = a + (m_Width * static_cast<T>(j) / static_cast<T>(2U * K));
+						
+						const auto expected = _f(t);
+						const auto actual   = Interpolate(t);
+						
+						for (std::size_t c = 0U; c < 3U; ++c) {
+							error = std::max(error, std::abs(actual[c] - expected[c]));
+						}
+					}
+				}
+				
+				return error;
+			}
+			
+		public:
+			
+			/**
+			 * @brief Fits a function returning orientations over a window of epochs.
+			 *
+			 * @param[in] _f Callable returning the orientation at an epoch.
+			 * @param[in] _begin The first epoch of the window.
+			 * @param[in] _end The last epoch of the window.
+			 * @param[in] _segment The initial length of each segment, clamped to the length of the window if not positive.
+			 * @param[in] _tolerance The largest acceptable absolute error in any component (degrees).
+			 * @param[in] _max_segments The largest number of segments to subdivide the window into.
+			 */
+			template<typename F>
+			Chebyshev(const F& _f, const T& _begin, const T& _end, const T& _segment, const T& _tolerance, const std::size_t& _max_segments = 1U << 20U) :
+				m_Begin(_begin),
+				m_Width(),
+				m_Error(),
+				m_Segments()
+			{
+				static_assert(K > 1U, "At least two coefficients are required.");
+				
+				const T span   = _end - _begin;
+				const T length = span > std::numeric_limits<T>::min() ? span : std::numeric_limits<T>::min();
+				
+				// Zero, negative and NaN segments fall back to one segment spanning the window.
+				const T segment = _segment > static_cast<T>(0.0) && _segment < length ? _segment : length;
+				
+				const T segments = std::ceil(length / segment);
+				
+				auto count = std::max<std::size_t>(segments < static_cast<T>(_max_segments) ? static_cast<std::size_t>(segments) : _max_segments, 1U);
+				
+				while (true) {
+					
+					m_Width = length / static_cast<T>(count);
+					m_Error = Build(_f, count);
+					
+					if (m_Error <= _tolerance || count * 2U > _max_segments) {
+						break;
+					}
+					
+					count *= 2U;
+				}
+			}
+			
+			/**
+			 * @brief Returns the largest error found when validating the fit.
+			 */
+			[[nodiscard]] const T& Error() const {
+				return m_Error;
+			}
+			
+			/**
+			 * @brief Returns the number of segments the window was divided into.
+			 */
+			[[nodiscard]] std::size_t Segments() const {
+				return m_Segments.size();
+			}
+			
+			/**
+			 * @brief Returns the approximated orientation at an epoch.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The orientation as alpha, delta and W (degrees).
+			 */
+			[[nodiscard]] std::array<T, 3U> Get(const T& _t) const {
+				
+				const T x = (_t - m_Begin) / m_Width;
+				
+				// A lookup outside of the fitted window is extrapolated from its first or last segment.
+				if (x >= static_cast<T>(0.0) && x <= static_cast<T>(m_Segments.size())) {
+					Count([](auto& _c) -> auto& { return _c.chebyshev_hits; });
+				}
+				else {
+					Count([](auto& _c) -> auto& { return _c.chebyshev_misses; });
+				}
+				
+				return Interpolate(_t);
+			}
+		};
+		
+		/**
+		 * @brief Creates a Chebyshev approximation of a body's orientation over a window of epochs.
+		 *
+		 * @tparam B The body.
+		 * @tparam K Number of Chebyshev coefficients per segment and component.
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _begin The first epoch of the window.
+		 * @param[in] _end The last epoch of the window.
+		 * @param[in] _segment The initial length of each segment.
+		 * @param[in] _tolerance The largest acceptable absolute error in any component (degrees).
+		 * @return The approximation. Check Chebyshev::Error() for the tolerance achieved.
+		 */
+		template<Body B, std::size_t K = 12U, typename P = DefaultReports, typename T>
+		static Chebyshev<T, K> GetChebyshev(const T& _begin, const T& _end, const T& _segment, const T& _tolerance) {
+			return Chebyshev<T, K>([](const T& _t) { return Registry<P>::template GetOrientation<B>(_t); }, _begin, _end, _segment, _tolerance);
+		}
+		
+		/**
+		 * @brief Serves low-precision orientations within a window of epochs from a fixed-step table of samples.
+		 *
+		 * @details Alpha, delta and W are sampled together with their rates at evenly-spaced epochs around a centre. W is
+		 * unwrapped across samples using its rate, so the step may exceed the time taken to rotate by 180 degrees. Queries
+		 * cost one division-free index computation, a gather of the two neighbouring samples, and a linear or cubic
+		 * Hermite interpolation per component, with no dependence on the number of terms in the model. The batched
+		 * queries are vectorised through the same instruction sets as the batched evaluators.
+		 *
+		 * The table holds six values per sample. The step must be short against the fastest periodic term of the body:
+		 *
+		 * | Body         | Step     | Cubic error  | Linear error |
+		 * |--------------|----------|--------------|--------------|
+		 * | Planets, Sol | 10 days  | 2e-6 arcsec  | 2e-6 arcsec  |
+		 * | Moon         | 1 day    | 5e-3 arcsec  | 2 arcsec     |
+		 * | Io, Mimas    | 1 day    | 1e-6 arcsec  | 3e-3 arcsec  |
+		 * | Phobos       | 0.05 day | 7 arcsec     | 300 arcsec   |
+		 *
+		 * (double, within 60 days of 2024). Error() reports the worst error found at the midpoints between samples.
+		 *
+		 * @note Queries outside of the window are clamped to its first or last sample. The precision of the epochs limits
+		 * W in float; prefer double unless the epochs are small.
+		 */
+		template<typename T>
+		class LookupTable final {
+		
+		private:
+			
+			T m_Begin, m_Step, m_Scale;
+			
+			std::array<T, 2U> m_Error;
+			
+			std::vector<T> m_Samples;
+			
+			[[nodiscard]] std::array<T, 3U> Window() const {
+				return { m_Begin, m_Scale, static_cast<T>(Count() - 1U) };
+			}
+			
+		public:
+			
+			/**
+			 * @brief Samples a function returning orientations and their rates over a window of epochs.
+			 *
+			 * @param[in] _f Callable returning the State at an epoch, with rates per unit of the epoch.
+			 * @param[in] _centre The epoch at the centre of the window.
+			 * @param[in] _radius Half of the length of the window.
+			 * @param[in] _step The interval between samples.
+			 */
+			template<typename F>
+			LookupTable(const F& _f, const T& _centre, const T& _radius, const T& _step) :
+				m_Begin(),
+				m_Step(_step),
+				m_Scale(static_cast<T>(1.0) / _step),
+				m_Error{},
+				m_Samples()
+			{
+				const auto half = static_cast<std::size_t>(std::ceil(std::max(_radius, static_cast<T>(0.0)) / _step));
+				
+				const std::size_t count = std::max<std::size_t>((2U * half) + 1U, 2U);
+				
+				m_Begin = _centre - (static_cast<T>(half) * _step);
+				
+				m_Samples.resize(count * 6U);
+				
+				for (std::size_t i = 0U; i < count; ++i) {
+					
+					const auto state = _f(m_Begin + (static_cast<T>(i) * _step));
+					
+					T* record = m_Samples.data() + (i * 6U);
+					
+					for (std::size_t c = 0U; c < 3U; ++c) {
+						record[c]      = state.value[c];
+						record[c + 3U] = state.rate[c] * _step;
+					}
+					
+					// Choose the turn of W closest to that predicted from the previous sample and the mean of their rates.
+					if (i > 0U) {
+						
+						const T* previous = record - 6U;
+						
+						const T predicted = previous[2U] + (static_cast<T>(0.5) * (previous[5U] + record[5U]));
+						
+						record[2U] += static_cast<T>(360.0) * std::round((predicted - record[2U]) / static_cast<T>(360.0));
+					}
+				}
+				
+				// Validate at the midpoints between samples, where the error of the interpolation peaks.
+				for (std::size_t i = 0U; i + 1U < count; ++i) {
+					
+					const T t = m_Begin + ((static_cast<T>(i) + static_cast<T>(0.5)) * _step);
+					
+					const auto expected = _f(t).value;
+					
+					const std::array<std::array<T, 3U>, 2U> actual { Get<Interpolation::Linear>(t), Get<Interpolation::Cubic>(t) };
+					
+					for (std::size_t j = 0U; j < 2U; ++j) {
+						for (std::size_t c = 0U; c < 3U; ++c) {
+							
+							T error = std::abs(actual[j][c] - expected[c]);
+							
+							if (c == 2U) {
+								error = std::abs(fmod_d(error + static_cast<T>(180.0)) - static_cast<T>(180.0));
+							}
+							
+							m_Error[j] = std::max(m_Error[j], error);
+						}
+					}
+				}
+			}
+			
+			/**
+			 * @brief Returns the largest error found at the midpoints between samples (degrees).
+			 *
+			 * @param[in] _interpolation The method of interpolation.
+			 */
+			[[nodiscard]] const T& Error(const Interpolation& _interpolation = Interpolation::Cubic) const {
+				return m_Error[static_cast<std::size_t>(_interpolation)];
+			}
+			
+			/**
+			 * @brief Returns the number of samples.
+			 */
+			[[nodiscard]] std::size_t Count() const {
+				return m_Samples.size() / 6U;
+			}
+			
+			/**
+			 * @brief Returns the first epoch of the window.
+			 */
+			[[nodiscard]] const T& Begin() const {
+				return m_Begin;
+			}
+			
+			/**
+			 * @brief Returns the last epoch of the window.
+			 */
+			[[nodiscard]] T End() const {
+				return m_Begin + (static_cast<T>(Count() - 1U) * m_Step);
+			}
+			
+			/**
+			 * @brief Returns the samples, as six values per sample: alpha, delta and unwrapped W, then their changes over
+			 * one step. Suited to uploading to consumers such as shaders.
+			 */
+			[[nodiscard]] const std::vector<T>& Samples() const {
+				return m_Samples;
+			}
+			
+			/**
+			 * @brief Returns the interpolated orientation at an epoch.
+			 *
+			 * @tparam I The method of interpolation.
+			 * @param[in] _t The epoch.
+			 * @return The orientation as alpha, delta and W (degrees), with W in [0, 360).
+			 */
+			template<Interpolation I = Interpolation::Cubic>
+			[[nodiscard]] std::array<T, 3U> Get(const T& _t) const {
+				
+				std::array<T, 3U> result{};
+				lookup_kernel<SIMD::Scalar<T>, I>(m_Samples.data(), static_cast<T>(Count() - 1U), (_t - m_Begin) * m_Scale, result[0], result[1], result[2]);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Batched variant of Get() interpolating many epochs.
+			 *
+			 * @tparam I The method of interpolation.
+			 * @param[in] _t Pointer to the first of \p _count epochs.
+			 * @param[in] _count Number of epochs.
+			 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+			 * @param[out] _delta Pointer to storage for \p _count values of delta.
+			 * @param[out] _W Pointer to storage for \p _count values of W, in [0, 360).
+			 */
+			template<Interpolation I = Interpolation::Cubic>
+			void Get(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) const {
+				lookup_d<T, I>(m_Samples.data(), Window(), _t, _count, _alpha, _delta, _W);
+			}
+		};
+		
+		/**
+		 * @brief Creates a LookupTable of a body's orientation around an epoch.
+		 *
+		 * @details The samples are evaluated with split epochs, so W is sampled at full precision however far the window
+		 * lies from J2000.0.
+		 *
+		 * @tparam B The body.
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _centre The epoch at the centre of the window.
+		 * @param[in] _radius Half of the length of the window.
+		 * @param[in] _step The interval between samples.
+		 * @return The table. Check LookupTable::Error() for the accuracy achieved.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static LookupTable<T> GetLookupTable(const T& _centre, const T& _radius, const T& _step) {
+			
+			return LookupTable<T>([](const T& _t) {
+				
+				const T days  = _t * static_cast<T>(365250.0);
+				const T whole = std::floor(days);
+				
+				return GetState<B, T, P>(SplitEpoch<T> { whole, days - whole });
+				
+			}, _centre, _radius, _step);
+		}
+		
+		/**
+		 * @brief A rotational model re-centred on an epoch, for evaluation in a narrow scalar type such as float.
+		 *
+		 * @details Evaluating a model directly in float loses most of its precision to the size of the epoch in days,
+		 * which W multiplies by rates of up to ~870 degrees per day. Re-centring expands the model about an epoch in
+		 * double precision once, reducing every periodic constant modulo 360, after which it is evaluated entirely in
+		 * \p T as a function of the (small) offset from that epoch. The coefficients may also be uploaded as-is to
+		 * consumers such as shaders.
+		 *
+		 * @note W is returned modulo 360 at the epoch, i.e. it differs from the unreduced value by a multiple of 360.
+		 *
+		 * @remarks Maximum absolute error of the float evaluation against the double-precision model, in degrees, for
+		 * offsets of up to one day and up to one year (365.25 days) from the epoch:
+		 *
+		 * | Body    | alpha, delta (1 day) | W (1 day) | alpha, delta (1 year) | W (1 year) |
+		 * |---------|----------------------|-----------|-----------------------|------------|
+		 * | Sol     | 1e-5                 | 1e-4      | 1e-5                  | 1e-3       |
+		 * | Mercury | 2e-5                 | 1e-4      | 5e-5                  | 1e-3       |
+		 * | Venus   | 1e-5                 | 1e-4      | 1e-5                  | 1e-4       |
+		 * | Earth   | 1e-5                 | 1e-4      | 1e-5                  | 2e-2       |
+		 * | Moon    | 1e-4                 | 2e-4      | 1e-4                  | 3e-3       |
+		 * | Mars    | 5e-5                 | 2e-4      | 1e-4                  | 3e-2       |
+		 * | Jupiter | 5e-5                 | 2e-4      | 1e-4                  | 5e-2       |
+		 * | Saturn  | 1e-5                 | 2e-4      | 1e-5                  | 5e-2       |
+		 * | Uranus  | 1e-5                 | 1e-4      | 1e-5                  | 3e-2       |
+		 * | Neptune | 5e-5                 | 1e-4      | 5e-5                  | 3e-2       |
+		 *
+		 * Re-centre at least as often as the error required allows.
+		 *
+		 * @tparam A Number of arguments of the model.
+		 * @tparam N Number of periodic terms of the model.
+		 */
+		template<typename T, std::size_t A, std::size_t N>
+		class Recentred final {
+		
+		private:
+			
+			double m_Epoch;
+			
+			Model<T, A, N> m_Model;
+			
+		public:
+			
+			/**
+			 * @brief Re-centres a double-precision model on an epoch.
+			 *
+			 * @param[in] _model The source model.
+			 * @param[in] _epoch The epoch to re-centre on.
+			 */
+			constexpr Recentred(const Model<double, A, N>& _model, const double& _epoch) :
+				m_Epoch(_epoch),
+				m_Model(Rebase<T>(_model, _epoch)) {}
+			
+			/**
+			 * @brief Returns the epoch the model is centred on.
+			 */
+			[[nodiscard]] constexpr const double& Epoch() const {
+				return m_Epoch;
+			}
+			
+			/**
+			 * @brief Returns the re-centred coefficients, as functions of the offset from Epoch().
+			 */
+			[[nodiscard]] constexpr const Model<T, A, N>& Coefficients() const {
+				return m_Model;
+			}
+			
+			/**
+			 * @brief Returns the orientation at an offset from the epoch.
+			 *
+			 * @param[in] _offset The offset from Epoch(), in the same units as the epoch.
+			 * @return The orientation as alpha, delta and W (degrees).
+			 */
+			[[nodiscard]] constexpr std::array<T, 3U> Get(const T& _offset) const {
+				return Evaluate(m_Model, _offset);
+			}
+			
+			/**
+			 * @brief Batched variant of Get() writing alpha, delta and W into separate arrays.
+			 *
+			 * @param[in] _offset Pointer to the first of \p _count offsets from Epoch().
+			 * @param[in] _count Number of offsets to evaluate.
+			 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+			 * @param[out] _delta Pointer to storage for \p _count values of delta.
+			 * @param[out] _W Pointer to storage for \p _count values of W.
+			 */
+			void Get(const T* _offset, const std::size_t& _count, T* _alpha, T* _delta, T* _W) const {
+				Evaluate(m_Model, _offset, _count, _alpha, _delta, _W);
+			}
+		};
+		
+		/**
+		 * @brief Creates a Recentred model of a body.
+		 *
+		 * @tparam B The body.
+		 * @tparam T The scalar type to evaluate in.
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _epoch The epoch to re-centre on.
+		 * @return The re-centred model.
+		 */
+		template<Body B, typename T = float, typename P = DefaultReports>
+		static constexpr auto GetRecentred(const double& _epoch) {
+			
+			const auto& model = GetModel<B, double, P>();
+			
+			return Recentred<T, model.arguments.size(), model.terms.size()>(model, _epoch);
+		}
+		
+		/**
+		 * @brief The arguments of a planet's satellite system, evaluated at one epoch.
+		 *
+		 * @details Construction evaluates the system's arguments, and their sines and cosines, once. Each satellite's
+		 * orientation is then its base polynomials plus its periodic terms, with no further trigonometry.
+		 *
+		 * @tparam P The planet, e.g. Body::Jupiter.
+		 * @tparam R The report policy, see Reports.
+		 */
+		template<Body P, typename T, typename R = DefaultReports>
+		class System final {
+		
+		private:
+			
+			static_assert(GetSystemOwner<P>() != P, "The body has no satellites.");
+			
+			static constexpr const auto& s_Arguments = GetModel<GetSystemOwner<P>(), T, R>().arguments;
+			
+			T m_T;
+			
+			std::array<T, s_Arguments.size()> m_Sin;
+			std::array<T, s_Arguments.size()> m_Cos;
+			
+		public:
+			
+			/**
+			 * @brief Evaluates the system's arguments.
+			 *
+			 * @param[in] _t The epoch.
+			 */
+			constexpr explicit System(const T& _t) :
+				m_T(_t),
+				m_Sin{},
+				m_Cos{}
+			{
+				std::array<T, s_Arguments.size()> x{};
+				for (std::size_t i = 0U; i < x.size(); ++i) {
+					x[i] = s_Arguments[i].Evaluate(_t);
+				}
+				
+				sincos_d(x.data(), m_Sin.data(), m_Cos.data(), x.size());
+			}
+			
+			/**
+			 * @brief Returns the epoch the system was evaluated at.
+			 */
+			constexpr const T& Epoch() const {
+				return m_T;
+			}
+			
+			/**
+			 * @brief Returns the orientation of one of the system's satellites.
+			 *
+			 * @tparam S The satellite.
+			 * @return The orientation of the satellite as alpha, delta and W (degrees).
+			 */
+			template<Body S>
+			constexpr std::array<T, 3U> GetOrientation() const {
+				
+				static_assert(GetPrimary<S>() == P && S != P, "The body is not a satellite of this system.");
+				
+				CountEvaluation(S);
+				
+				const auto& model = GetModel<S, T, R>();
+				
+				auto result = EvaluateBase(model, m_T);
+				
+				if constexpr (model.arguments.size() > 0U) {
+					
+					static_assert(SharesArguments<S, GetSystemOwner<P>(), T, R>(), "Satellites of a system must share their arguments.");
+					
+					ApplyTerms(model, m_Sin.data(), m_Cos.data(), result);
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Returns the orientation of one of the system's satellites.
+			 *
+			 * @param[in] _body The satellite.
+			 * @return The orientation of the satellite as alpha, delta and W (degrees), or an empty optional if \p _body is not a satellite of this system.
+			 */
+			constexpr std::optional<std::array<T, 3U>> GetOrientation(const Body& _body) const {
+				
+				return Dispatch(_body, [&](auto _b) -> std::optional<std::array<T, 3U>> {
+					
+					constexpr auto body = decltype(_b)::value;
+					
+					if constexpr (GetPrimary<body>() == P && body != P) {
+						return GetOrientation<body>();
+					}
+					else {
+						return std::nullopt;
+					}
+				});
+			}
+		};
+		
+		/**
+		 * @brief Memoises the orientations of bodies, and the sines and cosines of their arguments, at the most recently
+		 * queried epochs.
+		 *
+		 * @details Each of \p N slots holds one epoch, the orientations of whichever bodies have been queried at it, and
+		 * the trigonometry of their arguments. A repeated query costs a comparison per slot and a copy. The first query of
+		 * a body at an epoch evaluates its arguments only if no body sharing them (such as another satellite of the same
+		 * system) has been queried at that epoch, leaving just its base polynomials and periodic terms to sum. The least
+		 * recently inserted epoch is replaced when a new one is queried. Instances are not synchronised; use one per
+		 * thread, such as GetThreadCache().
+		 *
+		 * @tparam N Number of epochs retained.
+		 * @tparam P The report policy, see Reports.
+		 */
+		template<typename T, std::size_t N = 4U, typename P = DefaultReports>
+		class Cache final {
+		
+		private:
+			
+			struct Entry final {
+				
+				T t;
+				
+				/** @brief Bit i is set if the orientation of the Body with underlying value i is present. */
+				std::uint32_t present;
+				
+				/** @brief Bit i is set if the arguments owned by the Body with underlying value i are present. */
+				std::uint32_t arguments;
+				
+				Orientations<T> values;
+				
+				/** @brief Sines and cosines of the arguments of every Body, at the offsets of s_ArgumentOffsets. */
+				std::array<T, s_ArgumentOffsets<T, P>.back()> sin, cos;
+			};
+			
+			static_assert(N > 0U, "At least one slot is required.");
+			static_assert(s_BodyNames.size() <= 32U, "Every Body must have a bit in Entry::present.");
+			
+			std::array<Entry, N> m_Entries;
+			
+			std::size_t m_Next;
+			
+			Entry& Find(const T& _t) {
+				
+				for (auto& entry : m_Entries) {
+					
+					if (entry.present != 0U && entry.t == _t) {
+						return entry;
+					}
+				}
+				
+				auto& entry = m_Entries[m_Next];
+				m_Next = (m_Next + 1U) % N;
+				
+				entry.t         = _t;
+				entry.present   = 0U;
+				entry.arguments = 0U;
+				
+				return entry;
+			}
+			
+			/**
+			 * @brief Evaluates a body at the epoch of an entry, reusing or filling in the trigonometry of its arguments.
+			 */
+			template<Body B>
+			static std::array<T, 3U> Compute(Entry& _entry) {
+				
+				CountEvaluation(B);
+				
+				constexpr auto owner  = static_cast<std::size_t>(GetArgumentOwner<B>());
+				constexpr auto offset = s_ArgumentOffsets<T, P>[owner];
+				constexpr auto count  = s_ArgumentOffsets<T, P>[owner + 1U] - offset;
+				
+				const auto& model = GetModel<B, T, P>();
+				
+				auto result = EvaluateBase(model, _entry.t);
+				
+				if constexpr (count > 0U) {
+					
+					const auto bit = std::uint32_t(1U) << owner;
+					
+					if ((_entry.arguments & bit) == 0U) {
+						
+						std::array<T, count> x{};
+						for (std::size_t i = 0U; i < count; ++i) {
+							x[i] = model.arguments[i].Evaluate(_entry.t);
+						}
+						
+						sincos_d(x.data(), _entry.sin.data() + offset, _entry.cos.data() + offset, count);
+						
+						_entry.arguments |= bit;
+					}
+					
+					ApplyTerms(model, _entry.sin.data() + offset, _entry.cos.data() + offset, result);
+				}
+				
+				return result;
+			}
+			
+		public:
+			
+			constexpr Cache() :
+				m_Entries{},
+				m_Next(0U) {}
+			
+			/**
+			 * @brief Returns the orientation of a body, evaluating it only if not already present.
+			 *
+			 * @param[in] _body The body.
+			 * @param[in] _t The epoch.
+			 * @return A copy of the orientation of the body as alpha, delta and W (degrees), which later queries cannot
+			 * overwrite.
+			 */
+			std::array<T, 3U> GetOrientation(const Body& _body, const T& _t) {
+				
+				auto& entry = Find(_t);
+				
+				const auto bit = std::uint32_t(1U) << static_cast<std::uint32_t>(_body);
+				
+				if ((entry.present & bit) == 0U) {
+					
+					Count([](auto& _c) -> auto& { return _c.cache_misses; });
+					
+					entry.values[_body] = Dispatch(_body, [&](auto _b) { return Compute<decltype(_b)::value>(entry); });
+					entry.present |= bit;
+				}
+				else {
+					Count([](auto& _c) -> auto& { return _c.cache_hits; });
+				}
+				
+				return entry.values[_body];
+			}
+			
+			/**
+			 * @brief Returns the orientation of a body for use with VSOP87, evaluating it only if not already present.
+			 *
+			 * @param[in] _body The body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation of the body in the VSOP87 frame.
+			 */
+			std::array<T, 3U> GetOrientationVSOP87(const Body& _body, const T& _t) {
+				return ToVSOP87(GetOrientation(_body, _t));
+			}
+			
+			/**
+			 * @brief Returns the orientation of a body for use with VSOP87, resolving the body by name.
+			 *
+			 * @param[in] _name The name of the body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation of the body in the VSOP87 frame.
+			 */
+			std::array<T, 3U> GetOrientationVSOP87(const std::string_view& _name, const T& _t) {
+				
+				if (const auto body = GetBody(_name)) {
+					return GetOrientationVSOP87(*body, _t);
+				}
+				
+				return WGCCRE::GetOrientationVSOP87(_name, _t);
+			}
+			
+			/**
+			 * @brief Discards every memoised orientation.
+			 */
+			void Invalidate() {
+				
+				for (auto& entry : m_Entries) {
+					entry.present   = 0U;
+					entry.arguments = 0U;
+				}
+			}
+		};
+		
+		/**
+		 * @brief Returns a Cache private to the calling thread.
+		 *
+		 * @tparam N Number of epochs retained.
+		 * @tparam P The report policy, see Reports.
+		 */
+		template<typename T, std::size_t N = 4U, typename P = DefaultReports>
+		static Cache<T, N, P>& GetThreadCache() {
+			
+			thread_local Cache<T, N, P> cache;
+			
+			return cache;
+		}
+		
+		/**
+		 * @brief A lazily-evaluated range of batches of orientations of a set of bodies over evenly-spaced epochs.
+		 *
+		 * @details Each batch is evaluated with the batched evaluators when the iterator reaches it, into storage reused
+		 * from batch to batch. Memory is proportional to the batch size and the number of bodies, never to the length of
+		 * the range, and the first batch is available as soon as it has been evaluated.
+		 *
+		 * @note The range is single-pass: each call to begin() starts from the first batch again, and a Batch is only
+		 * valid until the iterator is advanced.
+		 *
+		 * @tparam P The report policy, see Reports.
+		 */
+		template<typename T, typename P = DefaultReports>
+		class Stream final {
+		
+		private:
+			
+			std::vector<Body> m_Bodies;
+			
+			T m_Begin, m_Step;
+			
+			std::size_t m_Count, m_Size;
+			
+			std::vector<T> m_Buffer;
+			
+			Batch<T> m_Batch;
+			
+			void Load(const std::size_t& _index) {
+				
+				const std::size_t offset = _index * m_Size;
+				
+				if (offset < m_Count) {
+					m_Batch = EvaluateBatch<P>(m_Bodies, m_Begin, m_Step, offset, std::min(m_Size, m_Count - offset), m_Buffer);
+				}
+			}
+			
+		public:
+			
+			/**
+			 * @brief Iterates over the batches of a Stream.
+			 */
+			class Iterator final {
+			
+			private:
+				
+				Stream* m_Stream;
+				
+				std::size_t m_Index;
+				
+			public:
+				
+				using iterator_category = std::input_iterator_tag;
+				using value_type        = Batch<T>;
+				using difference_type   = std::ptrdiff_t;
+				using pointer           = const Batch<T>*;
+				using reference         = const Batch<T>&;
+				
+				Iterator(Stream* _stream, const std::size_t& _index) :
+					m_Stream(_stream),
+					m_Index(_index) {}
+				
+				reference operator*() const {
+					return m_Stream->m_Batch;
+				}
+				
+				pointer operator->() const {
+					return &m_Stream->m_Batch;
+				}
+				
+				Iterator& operator++() {
+					
+					m_Stream->Load(++m_Index);
+					
+					return *this;
+				}
+				
+				bool operator==(const Iterator& _other) const {
+					return m_Index == _other.m_Index;
+				}
+				
+				bool operator!=(const Iterator& _other) const {
+					return m_Index != _other.m_Index;
+				}
+			};
+			
+			/**
+			 * @brief Creates a stream over evenly-spaced epochs.
+			 *
+			 * @param[in] _bodies The bodies to evaluate. Repetitions are ignored.
+			 * @param[in] _begin The first epoch.
+			 * @param[in] _step The interval between epochs.
+			 * @param[in] _count Number of epochs.
+			 * @param[in] _size Largest number of epochs per batch.
+			 */
+			Stream(const std::vector<Body>& _bodies, const T& _begin, const T& _step, const std::size_t& _count, const std::size_t& _size = 1024U) :
+				m_Bodies(Unique(_bodies)),
+				m_Begin(_begin),
+				m_Step(_step),
+				m_Count(_count),
+				m_Size(std::max<std::size_t>(_size, 1U)),
+				m_Buffer(),
+				m_Batch{} {}
+			
+			/**
+			 * @brief Returns the number of batches in the stream.
+			 */
+			[[nodiscard]] std::size_t Batches() const {
+				return (m_Count + m_Size - 1U) / m_Size;
+			}
+			
+			/**
+			 * @brief Evaluates the first batch, and returns an iterator to it.
+			 */
+			Iterator begin() {
+				
+				Load(0U);
+				
+				return { this, 0U };
+			}
+			
+			/**
+			 * @brief Returns an iterator past the last batch.
+			 */
+			Iterator end() {
+				return { this, Batches() };
+			}
+		};
+
+#if defined(LOUIERIKSSON_WGCCRE_COROUTINES)
+		
+		/**
+		 * @brief A C++20 coroutine lazily yielding batches of orientations, as returned by Generate().
+		 *
+		 * @details Iterating resumes the coroutine, which evaluates the next batch and suspends until it is consumed. Like
+		 * Stream, the range is single-pass and a Batch is only valid until the iterator is advanced.
+		 */
+		template<typename T>
+		class Generator final {
+		
+		public:
+			
+			struct promise_type final {
+				
+				const Batch<T>* current = nullptr;
+				
+				Generator get_return_object() noexcept {
+					return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+				}
+				
+				std::suspend_always initial_suspend() const noexcept { return {}; }
+				std::suspend_always final_suspend()   const noexcept { return {}; }
+				
+				std::suspend_always yield_value(const Batch<T>& _batch) noexcept {
+					
+					current = &_batch;
+					
+					return {};
+				}
+				
+				void return_void() const noexcept {}
+				
+				[[noreturn]] void unhandled_exception() const noexcept {
+					std::terminate();
+				}
+			};
+			
+			/**
+			 * @brief Iterates over the batches of a Generator.
+			 */
+			class Iterator final {
+			
+			private:
+				
+				std::coroutine_handle<promise_type> m_Handle;
+				
+			public:
+				
+				using iterator_category = std::input_iterator_tag;
+				using value_type        = Batch<T>;
+				using difference_type   = std::ptrdiff_t;
+				using pointer           = const Batch<T>*;
+				using reference         = const Batch<T>&;
+				
+				explicit Iterator(const std::coroutine_handle<promise_type>& _handle) :
+					m_Handle(_handle) {}
+				
+				reference operator*() const {
+					return *m_Handle.promise().current;
+				}
+				
+				pointer operator->() const {
+					return m_Handle.promise().current;
+				}
+				
+				Iterator& operator++() {
+					
+					m_Handle.resume();
+					
+					return *this;
+				}
+				
+				bool operator==(const Iterator& _other) const {
+					return Done() == _other.Done();
+				}
+				
+				bool operator!=(const Iterator& _other) const {
+					return !(*this == _other);
+				}
+				
+			private:
+				
+				[[nodiscard]] bool Done() const {
+					return !m_Handle || m_Handle.done();
+				}
+			};
+			
+		private:
+			
+			std::coroutine_handle<promise_type> m_Handle;
+			
+			explicit Generator(const std::coroutine_handle<promise_type>& _handle) noexcept :
+				m_Handle(_handle) {}
+			
+		public:
+			
+			Generator(const Generator&) = delete;
+			Generator& operator=(const Generator&) = delete;
+			
+			Generator(Generator&& _other) noexcept :
+				m_Handle(std::exchange(_other.m_Handle, nullptr)) {}
+			
+			Generator& operator=(Generator&& _other) noexcept {
+				
+				if (this != &_other) {
+					
+					if (m_Handle) {
+						m_Handle.destroy();
+					}
+					
+					m_Handle = std::exchange(_other.m_Handle, nullptr);
+				}
+				
+				return *this;
+			}
+			
+			~Generator() {
+				
+				if (m_Handle) {
+					m_Handle.destroy();
+				}
+			}
+			
+			/**
+			 * @brief Evaluates the first batch, and returns an iterator to it.
+			 *
+			 * @note May be called only once.
+			 */
+			Iterator begin() {
+				
+				m_Handle.resume();
+				
+				return Iterator(m_Handle);
+			}
+			
+			/**
+			 * @brief Returns an iterator past the last batch.
+			 */
+			Iterator end() {
+				return Iterator(nullptr);
+			}
+		};
+		
+		/**
+		 * @brief Returns a coroutine lazily yielding batches of orientations of a set of bodies over evenly-spaced epochs.
+		 *
+		 * @details Equivalent to iterating a Stream with the same arguments, for pipelines built from coroutines.
+		 *
+		 * @tparam P The report policy, see Reports.
+		 * @param[in] _bodies The bodies to evaluate. Repetitions are ignored.
+		 * @param[in] _begin The first epoch.
+		 * @param[in] _step The interval between epochs.
+		 * @param[in] _count Number of epochs.
+		 * @param[in] _size Largest number of epochs per batch.
+		 * @return The generator, suspended before its first batch.
+		 */
+		template<typename T, typename P = DefaultReports>
+		static Generator<T> Generate(std::vector<Body> _bodies, T _begin, T _step, std::size_t _count, std::size_t _size = 1024U) {
+			
+			// Parameters are taken by value, so that they outlive the call in the coroutine frame.
+			const auto bodies = Unique(_bodies);
+			
+			_size = std::max<std::size_t>(_size, 1U);
+			
+			std::vector<T> buffer;
+			
+			for (std::size_t offset = 0U; offset < _count; offset += _size) {
+				co_yield EvaluateBatch<P>(bodies, _begin, _step, offset, std::min(_size, _count - offset), buffer);
+			}
+		}
+#endif
+		
+		/**
+		 * @brief Header of a binary orientation table, as written by TableWriter and read by TableReader.
+		 *
+		 * @details A table file is this 64-byte header followed by \p count records, one per epoch, each holding alpha,
+		 * delta and W (degrees) in that order as consecutive values of the stored scalar type. W is reduced to [0, 360),
+		 * so that it keeps the resolution of the stored type at any epoch. Record \p i is the orientation at epoch
+		 * <tt>begin + (i * step)</tt>. All fields are in the byte order of the machine that wrote the table.
+		 */
+		struct TableHeader final {
+			
+			/** @brief Identifies a table file. */
+			static constexpr std::array<char, 8U> s_Magic { 'W', 'G', 'C', 'C', 'R', 'E', 'T', 'B' };
+			
+			/** @brief Version of the format written by TableWriter. Version 1 stored W without reduction. */
+			static constexpr std::uint32_t s_Version = 2U;
+			
+			/** @brief Record layouts. */
+			enum class Layout : std::uint8_t {
+				Interleaved /**< @brief Alpha, delta and W stored consecutively per epoch. */
+			};
+			
+			std::array<char, 8U> magic;
+			
+			std::uint32_t version;
+			
+			/** @brief The Body tabulated. */
+			std::uint8_t body;
+			
+			/** @brief Binary digits of precision of the stored scalar type (24 for float, 53 for double). */
+			std::uint8_t precision;
+			
+			/** @brief Number of components per record. */
+			std::uint8_t components;
+			
+			/** @brief The record Layout. */
+			std::uint8_t layout;
+			
+			/** @brief Number of records. */
+			std::uint64_t count;
+			
+			/** @brief Epoch of the first record, and the interval between records. */
+			double begin, step;
+			
+			std::array<std::uint8_t, 24U> reserved;
+		};
+		
+		static_assert(sizeof(TableHeader) == 64U, "TableHeader must be 64 bytes so that the records following it stay aligned.");
+		
+		/**
+		 * @brief Streams the orientation of a body over evenly-spaced epochs into a binary table file.
+		 *
+		 * @details Records are appended either directly or by evaluating the next epochs of the table with the batched
+		 * evaluators. The record count in the header is updated by Close(), which is also called on destruction.
+		 *
+		 * @tparam T The scalar type stored in the table. Epochs are evaluated in at least double precision, and W is
+		 * reduced to [0, 360) before every value is rounded to \p T, so float tables keep their resolution at any epoch.
+		 * @tparam P The report policy, see Reports.
+		 */
+		template<typename T, typename P = DefaultReports>
+		class TableWriter final {
+		
+		private:
+			
+			/** @brief Scalar type the evaluators are run in. */
+			using E = std::conditional_t<(sizeof(T) > sizeof(double)), T, double>;
+			
+			std::FILE* m_File;
+			
+			TableHeader m_Header;
+			
+			bool m_Good;
+			
+			bool WriteHeader() {
+				return std::fseek(m_File, 0L, SEEK_SET) == 0 &&
+				       std::fwrite(&m_Header, sizeof(TableHeader), 1U, m_File) == 1U &&
+				       std::fseek(m_File, 0L, SEEK_END) == 0;
+			}
+			
+			/**
+			 * @brief Reduces W to [0, 360) in the precision it was evaluated in, before it is rounded to \p T.
+			 */
+			template<typename U>
+			static T Reduce(const U& _W) {
+				
+				const U result = fmod_d(_W);
+				
+				return static_cast<T>(result < static_cast<U>(0.0) ? result + static_cast<U>(360.0) : result);
+			}
+			
+		public:
+			
+			/**
+			 * @brief Creates (or truncates) a table file.
+			 *
+			 * @param[in] _path Path of the file.
+			 * @param[in] _body The body tabulated.
+			 * @param[in] _begin Epoch of the first record.
+			 * @param[in] _step Interval between records.
+			 */
+			TableWriter(const char* _path, const Body& _body, const double& _begin, const double& _step) :
+				m_File(std::fopen(_path, "wb")),
+				m_Header{},
+				m_Good(m_File != nullptr)
+			{
+				m_Header.magic      = TableHeader::s_Magic;
+				m_Header.version    = TableHeader::s_Version;
+				m_Header.body       = static_cast<std::uint8_t>(_body);
+				m_Header.precision  = static_cast<std::uint8_t>(std::numeric_limits<T>::digits);
+				m_Header.components = 3U;
+				m_Header.layout     = static_cast<std::uint8_t>(TableHeader::Layout::Interleaved);
+				m_Header.begin      = _begin;
+				m_Header.step       = _step;
+				
+				m_Good = m_Good && WriteHeader();
+			}
+			
+			TableWriter(const TableWriter&) = delete;
+			TableWriter& operator=(const TableWriter&) = delete;
+			
+			~TableWriter() {
+				Close();
+			}
+			
+			/**
+			 * @brief Returns true if the file is open and every write so far has succeeded.
+			 */
+			[[nodiscard]] bool Good() const {
+				return m_Good;
+			}
+			
+			/**
+			 * @brief Returns the number of records written.
+			 */
+			[[nodiscard]] std::size_t Count() const {
+				return static_cast<std::size_t>(m_Header.count);
+			}
+			
+			/**
+			 * @brief Appends one record.
+			 *
+			 * @param[in] _orientation The orientation at the next epoch of the table. W is reduced to [0, 360) as it is
+			 * written, but any precision it lost before being passed cannot be recovered.
+			 * @return true if the record was written.
+			 */
+			bool Append(const std::array<T, 3U>& _orientation) {
+				
+				const std::array<T, 3U> record { _orientation[0U], _orientation[1U], Reduce(_orientation[2U]) };
+				
+				m_Good = m_Good && std::fwrite(record.data(), sizeof(T), 3U, m_File) == 3U;
+				
+				if (m_Good) {
+					++m_Header.count;
+				}
+				
+				return m_Good;
+			}
+			
+			/**
+			 * @brief Evaluates the body at the next epochs of the table and appends them.
+			 *
+			 * @param[in] _count Number of records to append.
+			 * @return true if every record was written.
+			 */
+			bool Append(const std::size_t& _count) {
+				
+				constexpr std::size_t block = 256U;
+				
+				std::array<E, block> t, alpha, delta, W;
+				std::array<T, block * 3U> records;
+				
+				for (std::size_t i = 0U; i < _count && m_Good; i += block) {
+					
+					const std::size_t n = std::min(block, _count - i);
+					
+					for (std::size_t j = 0U; j < n; ++j) {
+						t[j] = static_cast<E>(m_Header.begin) + (static_cast<E>(m_Header.count + j) * static_cast<E>(m_Header.step));
+					}
+					
+					Dispatch(static_cast<Body>(m_Header.body), [&](auto _b) {
+						Registry<P>::template GetOrientation<decltype(_b)::value>(t.data(), n, alpha.data(), delta.data(), W.data());
+					});
+					
+					for (std::size_t j = 0U; j < n; ++j) {
+						records[(j * 3U)      ] = static_cast<T>(alpha[j]);
+						records[(j * 3U) + 1U] = static_cast<T>(delta[j]);
+						records[(j * 3U) + 2U] = Reduce(W[j]);
+					}
+					
+					m_Good = std::fwrite(records.data(), sizeof(T) * 3U, n, m_File) == n;
+					
+					if (m_Good) {
+						m_Header.count += n;
+					}
+				}
+				
+				return m_Good;
+			}
+			
+			/**
+			 * @brief Writes the final record count and closes the file.
+			 *
+			 * @return true if the table was written completely.
+			 */
+			bool Close() {
+				
+				if (m_File != nullptr) {
+					
+					m_Good = m_Good && WriteHeader();
+					m_Good = (std::fclose(m_File) == 0) && m_Good;
+					
+					m_File = nullptr;
+				}
+				
+				return m_Good;
+			}
+		};
+		
+		/**
+		 * @brief Provides interpolated lookups into a binary table file written by TableWriter.
+		 *
+		 * @details The file is memory-mapped read-only where the platform supports it, so opening a table costs only
+		 * the validation of its header, and lookups read the records directly from the mapped pages. Elsewhere, the file
+		 * is read into memory once.
+		 *
+		 * @tparam T The scalar type stored in the table. Tables of any other precision are rejected.
+		 * @tparam P The report policy the table was written with, which supplies the rate of W between records.
+		 */
+		template<typename T, typename P = DefaultReports>
+		class TableReader final {
+		
+		private:
+			
+			const unsigned char* m_Bytes;
+			
+			std::size_t m_Size;
+			
+			bool m_Mapped;
+			
+			std::vector<unsigned char> m_Buffer;
+			
+			TableHeader m_Header;
+			
+			/** @brief Mean advance of W between consecutive records, used to restore the turns removed by reduction. */
+			T m_Advance;
+			
+			const T* m_Records;
+			
+			void Open(const char* _path) {
+
+#if __has_include(<sys/mman.h>)
+				
+				const int file = ::open(_path, O_RDONLY);
+				
+				if (file != -1) {
+					
+					struct stat info {};
+					
+					if (::fstat(file, &info) == 0 && info.st_size > 0) {
+						
+						void* map = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+						
+						if (map != MAP_FAILED) {
+							m_Bytes  = static_cast<const unsigned char*>(map);
+							m_Size   = static_cast<std::size_t>(info.st_size);
+							m_Mapped = true;
+						}
+					}
+					
+					::close(file);
+				}
+#else
+				
+				if (std::FILE* file = std::fopen(_path, "rb")) {
+					
+					if (std::fseek(file, 0L, SEEK_END) == 0) {
+						
+						const long size = std::ftell(file);
+						
+						if (size > 0 && std::fseek(file, 0L, SEEK_SET) == 0) {
+							
+							m_Buffer.resize(static_cast<std::size_t>(size));
+							
+							if (std::fread(m_Buffer.data(), 1U, m_Buffer.size(), file) == m_Buffer.size()) {
+								m_Bytes = m_Buffer.data();
+								m_Size  = m_Buffer.size();
+							}
+						}
+					}
+					
+					std::fclose(file);
+				}
+#endif
+			}
+			
+			void Release() {
+
+#if __has_include(<sys/mman.h>)
+				if (m_Mapped) {
+					::munmap(const_cast<unsigned char*>(m_Bytes), m_Size);
+				}
+#endif
+				
+				m_Bytes   = nullptr;
+				m_Size    = 0U;
+				m_Mapped  = false;
+				m_Records = nullptr;
+				
+				m_Buffer.clear();
+			}
+			
+			bool Validate() {
+				
+				if (m_Bytes == nullptr || m_Size < sizeof(TableHeader)) {
+					return false;
+				}
+				
+				std::memcpy(&m_Header, m_Bytes, sizeof(TableHeader));
+				
+				return m_Header.magic      == TableHeader::s_Magic                                 &&
+				       m_Header.version    == TableHeader::s_Version                               &&
+				       m_Header.body        < s_BodyNames.size()                                   &&
+				       m_Header.precision  == static_cast<std::uint8_t>(std::numeric_limits<T>::digits) &&
+				       m_Header.components == 3U                                                   &&
+				       m_Header.layout     == static_cast<std::uint8_t>(TableHeader::Layout::Interleaved) &&
+				       m_Header.count       > 0U                                                   &&
+				       m_Header.count      <= (m_Size - sizeof(TableHeader)) / (sizeof(T) * 3U);
+			}
+			
+		public:
+			
+			/**
+			 * @brief Opens a table file.
+			 *
+			 * @param[in] _path Path of the file.
+			 */
+			explicit TableReader(const char* _path) :
+				m_Bytes(nullptr),
+				m_Size(0U),
+				m_Mapped(false),
+				m_Buffer(),
+				m_Header{},
+				m_Advance(),
+				m_Records(nullptr)
+			{
+				Open(_path);
+				
+				if (Validate()) {
+					
+					m_Records = reinterpret_cast<const T*>(m_Bytes + sizeof(TableHeader));
+					
+					m_Advance = static_cast<T>(m_Header.step * Dispatch(GetBody(), [](auto _b) {
+						return GetModel<decltype(_b)::value, double, P>().base[2U].Rate();
+					}));
+				}
+				else {
+					Release();
+				}
+			}
+			
+			TableReader(const TableReader&) = delete;
+			TableReader& operator=(const TableReader&) = delete;
+			
+			TableReader(TableReader&& _other) noexcept :
+				m_Bytes  (std::exchange(_other.m_Bytes,   nullptr)),
+				m_Size   (std::exchange(_other.m_Size,    0U)),
+				m_Mapped (std::exchange(_other.m_Mapped,  false)),
+				m_Buffer (std::move(_other.m_Buffer)),
+				m_Header (_other.m_Header),
+				m_Advance(_other.m_Advance),
+				m_Records(std::exchange(_other.m_Records, nullptr)) {}
+			
+			TableReader& operator=(TableReader&& _other) noexcept {
+				
+				if (this != &_other) {
+					
+					Release();
+					
+					m_Bytes   = std::exchange(_other.m_Bytes,   nullptr);
+					m_Size    = std::exchange(_other.m_Size,    0U);
+					m_Mapped  = std::exchange(_other.m_Mapped,  false);
+					m_Buffer  = std::move(_other.m_Buffer);
+					m_Header  = _other.m_Header;
+					m_Advance = _other.m_Advance;
+					m_Records = std::exchange(_other.m_Records, nullptr);
+				}
+				
+				return *this;
+			}
+			
+			~TableReader() {
+				Release();
+			}
+			
+			/**
+			 * @brief Returns true if the file was opened and holds a valid table of \p T.
+			 *
+			 * @note No other member may be used unless this returns true.
+			 */
+			[[nodiscard]] bool Good() const {
+				return m_Records != nullptr;
+			}
+			
+			/**
+			 * @brief Returns the header of the table.
+			 */
+			[[nodiscard]] const TableHeader& Header() const {
+				return m_Header;
+			}
+			
+			/**
+			 * @brief Returns the body tabulated.
+			 */
+			[[nodiscard]] Body GetBody() const {
+				return static_cast<Body>(m_Header.body);
+			}
+			
+			/**
+			 * @brief Returns the number of records in the table.
+			 */
+			[[nodiscard]] std::size_t Count() const {
+				return static_cast<std::size_t>(m_Header.count);
+			}
+			
+			/**
+			 * @brief Returns the record at an index.
+			 *
+			 * @param[in] _index The index of the record, which must be less than Count().
+			 * @return The orientation as alpha, delta and W (degrees).
+			 */
+			[[nodiscard]] std::array<T, 3U> At(const std::size_t& _index) const {
+				
+				const T* record = m_Records + (_index * 3U);
+				
+				return { record[0U], record[1U], record[2U] };
+			}
+			
+			/**
+			 * @brief Returns the orientation at an epoch, interpolated linearly between the nearest records.
+			 *
+			 * @note Epochs outside of the table are clamped to its first or last record. W is tabulated modulo 360, so
+			 * the whole turns between records are restored from the mean rotation rate of the body before interpolating.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The orientation as alpha, delta and W (degrees), with W in [0, 360).
+			 */
+			[[nodiscard]] std::array<T, 3U> Get(const double& _t) const {
+				
+				const std::size_t last = Count() - 1U;
+				
+				const double x = std::clamp((_t - m_Header.begin) / m_Header.step, 0.0, static_cast<double>(last));
+				
+				const std::size_t i = std::min(static_cast<std::size_t>(x), last == 0U ? 0U : last - 1U);
+				
+				if (i == last) {
+					return At(i);
+				}
+				
+				const T f = static_cast<T>(x - static_cast<double>(i));
+				
+				const T* a = m_Records + (i * 3U);
+				const T* b = a + 3U;
+				
+				// Choose the turn of the change in W closest to that predicted from the mean rate.
+				T dW = b[2U] - a[2U];
+				dW += static_cast<T>(360.0) * std::round((m_Advance - dW) / static_cast<T>(360.0));
+				
+				T W = fmod_d(a[2U] + (dW * f));
+				W = W < static_cast<T>(0.0) ? W + static_cast<T>(360.0) : W;
+				
+				return {
+					a[0U] + ((b[0U] - a[0U]) * f),
+					a[1U] + ((b[1U] - a[1U]) * f),
+					W
+				};
+			}
+		};
+		
+		/**
+		 * @brief OpenCL C source of a kernel evaluating a packed rotational model over a buffer of epochs.
+		 *
+		 * @details The kernel is generic over the model, which is uploaded as the buffer returned by GetPackedModel(), so
+		 * that the device always evaluates the same coefficients as the host. Compile it with <tt>-DREAL=float</tt> or
+		 * <tt>-DREAL=double</tt>; the latter requires cl_khr_fp64. One work-item evaluates one epoch, writing alpha, delta
+		 * and W into separate buffers.
+		 *
+		 * Trigonometry uses sinpi() and cospi() on the argument reduced modulo 360 in the degree domain. The polynomials are
+		 * evaluated exactly as on the CPU, so results differ from the batched CPU evaluators of the same precision only
+		 * by the rounding of the periodic terms: within a few units in the last place of each component, or about 1e-4
+		 * degrees in float and 1e-13 in double.
+		 */
+		static constexpr std::string_view s_KernelSource = R"(
+#ifndef REAL
+#define REAL float
+#endif
+
+#if defined(cl_khr_fp64)
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+__kernel void wgccre_evaluate(__global const REAL* model, const uint arguments, const uint terms,
+                              __global const REAL* t, const uint count,
+                              __global REAL* alpha, __global REAL* delta, __global REAL* W) {
+
+	const size_t i = get_global_id(0);
+
+	if (i >= count) {
+		return;
+	}
+
+	const REAL x = t[i];
+
+	REAL result[3];
+
+	for (uint k = 0U; k < 3U; ++k) {
+		__global const REAL* p = model + (k * 3U);
+
+		result[k] = p[0] + (x * (p[1] + (x * p[2])));
+	}
+
+	__global const REAL* argument = model + 9U;
+	__global const REAL* term     = argument + (arguments * 3U);
+
+	for (uint a = 0U; a < arguments; ++a) {
+
+		__global const REAL* p = argument + (a * 3U);
+
+		const REAL phase = fmod(p[0] + (x * (p[1] + (x * p[2]))), (REAL)360.0) / (REAL)180.0;
+
+		const REAL s = sinpi(phase);
+		const REAL c = cospi(phase);
+
+		for (uint n = 0U; n < terms; ++n) {
+
+			__global const REAL* q = term + (n * 4U);
+
+			if ((uint)q[2] == a) {
+				result[(uint)q[0]] += q[3] * (q[1] == (REAL)0.0 ? s : c);
+			}
+		}
+	}
+
+	alpha[i] = result[0];
+	delta[i] = result[1];
+	W[i]     = result[2];
+}
+)";
+		
+		/**
+		 * @brief Packs the rotational model of a body into the flat layout read by s_KernelSource.
+		 *
+		 * @details The layout is three base polynomials followed by every argument, each as (c0, rate, acceleration) with
+		 * the daily coefficients folded in, followed by every term as (component, function, argument, amplitude).
+		 *
+		 * @tparam B The body.
+		 * @tparam P The report policy, see Reports.
+		 * @return The packed model, of <tt>9 + (3 * arguments) + (4 * terms)</tt> values.
+		 */
+		template<Body B, typename T, typename P = DefaultReports>
+		static constexpr auto GetPackedModel() {
+			
+			const auto& model = GetModel<B, T, P>();
+			
+			std::array<T, 9U + (3U * model.arguments.size()) + (4U * model.terms.size())> result{};
+			
+			std::size_t i = 0U;
+			
+			const auto pack = [&](const Polynomial<T>& _p) {
+				result[i++] = _p.c0;
+				result[i++] = _p.Rate();
+				result[i++] = _p.Acceleration();
+			};
+			
+			for (const auto& p : model.base) {
+				pack(p);
+			}
+			
+			for (const auto& p : model.arguments) {
+				pack(p);
+			}
+			
+			for (const auto& term : model.terms) {
+				result[i++] = static_cast<T>(term.component);
+				result[i++] = static_cast<T>(term.function);
+				result[i++] = static_cast<T>(term.argument);
+				result[i++] = term.amplitude;
+			}
+			
+			return result;
+		}
+
+#if defined(LOUIERIKSSON_WGCCRE_OPENCL)
+		
+		/**
+		 * @brief Evaluates bodies over buffers of epochs on an OpenCL device.
+		 *
+		 * @details Available when LOUIERIKSSON_WGCCRE_OPENCL is defined before including this header. Builds
+		 * s_KernelSource once, and uploads the packed model of each body the first time it is evaluated. Every function
+		 * returns an OpenCL status code.
+		 *
+		 * @tparam T float, or double on devices supporting cl_khr_fp64.
+		 * @tparam P The report policy, see Reports.
+		 */
+		template<typename T, typename P = DefaultReports>
+		class Device final {
+		
+		private:
+			
+			static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "OpenCL kernels are available in float and double only.");
+			
+			cl_context       m_Context;
+			cl_command_queue m_Queue;
+			cl_program       m_Program;
+			cl_kernel        m_Kernel;
+			
+			cl_int m_Status;
+			
+			std::array<cl_mem, s_BodyCount> m_Models;
+			
+			/**
+			 * @brief The largest number of epochs evaluated by a single dispatch of the kernel.
+			 */
+			static constexpr std::size_t s_MaxDispatch = std::numeric_limits<cl_uint>::max();
+			
+			template<Body B>
+			cl_mem GetModelBuffer() {
+				
+				auto& buffer = m_Models[static_cast<std::size_t>(B)];
+				
+				if (buffer == nullptr && m_Status == CL_SUCCESS) {
+					
+					auto model = GetPackedModel<B, T, P>();
+					
+					buffer = clCreateBuffer(m_Context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(model), model.data(), &m_Status);
+				}
+				
+				return buffer;
+			}
+			
+		public:
+			
+			/**
+			 * @brief Builds the kernel for a device.
+			 *
+			 * @param[in] _context The context of the device.
+			 * @param[in] _device The device.
+			 * @param[in] _queue A command queue on the device, used by every evaluation.
+			 */
+			Device(const cl_context& _context, const cl_device_id& _device, const cl_command_queue& _queue) :
+				m_Context(_context),
+				m_Queue(_queue),
+				m_Program(nullptr),
+				m_Kernel(nullptr),
+				m_Status(CL_SUCCESS),
+				m_Models{}
+			{
+				clRetainContext(m_Context);
+				clRetainCommandQueue(m_Queue);
+				
+				const char*       source = s_KernelSource.data();
+				const std::size_t length = s_KernelSource.size();
+				
+				m_Program = clCreateProgramWithSource(m_Context, 1U, &source, &length, &m_Status);
+				
+				if (m_Status == CL_SUCCESS) {
+					m_Status = clBuildProgram(m_Program, 1U, &_device, std::is_same_v<T, double> ? "-DREAL=double" : "-DREAL=float", nullptr, nullptr);
+				}
+				
+				if (m_Status == CL_SUCCESS) {
+					m_Kernel = clCreateKernel(m_Program, "wgccre_evaluate", &m_Status);
+				}
+			}
+			
+			Device(const Device&) = delete;
+			Device& operator=(const Device&) = delete;
+			
+			~Device() {
+				
+				for (auto& buffer : m_Models) {
+					
+					if (buffer != nullptr) {
+						clReleaseMemObject(buffer);
+					}
+				}
+				
+				if (m_Kernel  != nullptr) { clReleaseKernel (m_Kernel);  }
+				if (m_Program != nullptr) { clReleaseProgram(m_Program); }
+				
+				clReleaseCommandQueue(m_Queue);
+				clReleaseContext(m_Context);
+			}
+			
+			/**
+			 * @brief Returns the status of building the kernel and of the most recent upload of a model.
+			 */
+			[[nodiscard]] cl_int Status() const {
+				return m_Status;
+			}
+			
+			/**
+			 * @brief Enqueues the evaluation of a body over a device buffer of epochs, without waiting for it.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t Buffer of \p _count epochs.
+			 * @param[in] _count Number of epochs.
+			 * @param[out] _alpha Buffer for \p _count values of alpha.
+			 * @param[out] _delta Buffer for \p _count values of delta.
+			 * @param[out] _W Buffer for \p _count values of W.
+			 * @return The OpenCL status code, or CL_INVALID_VALUE if \p _count exceeds s_MaxDispatch.
+			 */
+			template<Body B>
+			cl_int Evaluate(const cl_mem& _t, const std::size_t& _count, const cl_mem& _alpha, const cl_mem& _delta, const cl_mem& _W) {
+				
+				const cl_mem model = GetModelBuffer<B>();
+				
+				if (m_Status != CL_SUCCESS) {
+					return m_Status;
+				}
+				
+				// The kernel receives the count as a cl_uint, so larger buffers cannot be addressed in one dispatch.
+				if (_count > s_MaxDispatch) {
+					return CL_INVALID_VALUE;
+				}
+				
+				const auto& source = GetModel<B, T, P>();
+				
+				const cl_uint arguments = static_cast<cl_uint>(source.arguments.size());
+				const cl_uint terms     = static_cast<cl_uint>(source.terms.size());
+				const cl_uint count     = static_cast<cl_uint>(_count);
+				
+				cl_int result = CL_SUCCESS;
+				
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 0U, sizeof(cl_mem),  &model)     : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 1U, sizeof(cl_uint), &arguments) : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 2U, sizeof(cl_uint), &terms)     : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 3U, sizeof(cl_mem),  &_t)        : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 4U, sizeof(cl_uint), &count)     : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 5U, sizeof(cl_mem),  &_alpha)    : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 6U, sizeof(cl_mem),  &_delta)    : result;
+				result = result == CL_SUCCESS ? clSetKernelArg(m_Kernel, 7U, sizeof(cl_mem),  &_W)        : result;
+				
+				if (result == CL_SUCCESS && _count > 0U) {
+					result = clEnqueueNDRangeKernel(m_Queue, m_Kernel, 1U, nullptr, &_count, nullptr, 0U, nullptr, nullptr);
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Evaluates a body over host arrays of epochs on the device, blocking until the results are read back.
+			 *
+			 * @details Arrays of more than s_MaxDispatch epochs are evaluated in several dispatches.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t Pointer to the first of \p _count epochs.
+			 * @param[in] _count Number of epochs.
+			 * @param[out] _alpha Pointer to storage for \p _count values of alpha.
+			 * @param[out] _delta Pointer to storage for \p _count values of delta.
+			 * @param[out] _W Pointer to storage for \p _count values of W.
+			 * @return The OpenCL status code.
+			 */
+			template<Body B>
+			cl_int Evaluate(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				
+				const BatchScope scope(B, _count);
+				
+				cl_int result = CL_SUCCESS;
+				
+				for (std::size_t i = 0U; i < _count && result == CL_SUCCESS; i += s_MaxDispatch) {
+					result = Transfer<B>(_t + i, std::min<std::size_t>(_count - i, s_MaxDispatch), _alpha + i, _delta + i, _W + i);
+				}
+				
+				return result;
+			}
+			
+		private:
+			
+			/**
+			 * @brief Copies up to s_MaxDispatch epochs to the device, evaluates them, and reads the results back.
+			 */
+			template<Body B>
+			cl_int Transfer(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				
+				const std::size_t size = _count * sizeof(T);
+				
+				cl_int result = CL_SUCCESS;
+				
+				std::array<cl_mem, 4U> buffers{};
+				
+				buffers[0] = clCreateBuffer(m_Context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, size, const_cast<T*>(_t), &result);
+				
+				for (std::size_t i = 1U; i < buffers.size() && result == CL_SUCCESS; ++i) {
+					buffers[i] = clCreateBuffer(m_Context, CL_MEM_WRITE_ONLY, size, nullptr, &result);
+				}
+				
+				if (result == CL_SUCCESS) {
+					result = Evaluate<B>(buffers[0], _count, buffers[1], buffers[2], buffers[3]);
+				}
+				
+				const std::array<T*, 3U> out { _alpha, _delta, _W };
+				
+				for (std::size_t i = 0U; i < out.size() && result == CL_SUCCESS; ++i) {
+					result = clEnqueueReadBuffer(m_Queue, buffers[i + 1U], i + 1U == out.size() ? CL_TRUE : CL_FALSE, 0U, size, out[i], 0U, nullptr, nullptr);
+				}
+				
+				for (auto& buffer : buffers) {
+					
+					if (buffer != nullptr) {
+						clReleaseMemObject(buffer);
+					}
+				}
+				
+				return result;
+			}
+		};
+#endif
+		
+		/**
+		 * @brief Provides orientations of astronomical objects as outlined in the 2015 WGCCRE report.
+		 *
+		 * @see https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2015reprint.pdf
+		 */
+		struct Report_2015 final {
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Sol {
+				{{
+					{ 286.13,  0.0,  0.0,       0.0 },
+					{  63.87,  0.0,  0.0,       0.0 },
+					{  84.176, 0.0, 14.1844000, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 5U, 5U> s_Mercury {
+				{{
+					{ 281.0103, -0.0328, 0.0,       0.0 },
+					{  61.4155, -0.0049, 0.0,       0.0 },
+					{ 329.5988,  0.0,    6.1385108, 0.0 }     // (± 0.0037)
+				}},
+				{{
+					{ 174.7910857, 0.0,  4.092335, 0.0 },     // M1
+					{ 349.5821714, 0.0,  8.184670, 0.0 },     // M2
+					{ 164.3732571, 0.0, 12.277005, 0.0 },     // M3
+					{ 339.1643429, 0.0, 16.369340, 0.0 },     // M4
+					{ 153.9554286, 0.0, 20.461675, 0.0 }      // M5
+				}},
+				{{
+					{ Component::W, Trig::Sin, 0U,  0.01067257 },
+					{ Component::W, Trig::Sin, 1U, -0.00112309 },
+					{ Component::W, Trig::Sin, 2U, -0.00011040 },
+					{ Component::W, Trig::Sin, 3U, -0.00002539 },
+					{ Component::W, Trig::Sin, 4U, -0.00000571 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Venus {
+				{{
+					{ 272.76, 0.0,  0.0,       0.0 },
+					{  67.16, 0.0,  0.0,       0.0 },
+					{ 160.20, 0.0, -1.4813688, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 16U, 16U> s_Mars {
+				{{
+					{ 317.269202, -0.10927547, 0.0,              0.0 },
+					{  54.432516, -0.05827105, 0.0,              0.0 },
+					{ 176.049863,  0.0,        350.891982443297, 0.0 }
+				}},
+				{{
+					{ 198.991226, 19139.4819985, 0.0, 0.0 },
+					{ 226.292679, 38280.8511281, 0.0, 0.0 },
+					{ 249.663391, 57420.7251593, 0.0, 0.0 },
+					{ 266.183510, 76560.6367950, 0.0, 0.0 },
+					{  79.398797,     0.5042615, 0.0, 0.0 },
+					{ 122.433576, 19139.9407476, 0.0, 0.0 },
+					{  43.058401, 38280.8753272, 0.0, 0.0 },
+					{  57.663379, 57420.7517205, 0.0, 0.0 },
+					{  79.476401, 76560.6495004, 0.0, 0.0 },
+					{ 166.325722,     0.5042615, 0.0, 0.0 },
+					{ 129.071773, 19140.0328244, 0.0, 0.0 },
+					{  36.352167, 38281.0473591, 0.0, 0.0 },
+					{  56.668646, 57420.9295360, 0.0, 0.0 },
+					{  67.364003, 76560.2552215, 0.0, 0.0 },
+					{ 104.792680, 95700.4387578, 0.0, 0.0 },
+					{  95.391654,     0.5042615, 0.0, 0.0 }
+				}},
+				{{
+					{ Component::Alpha, Trig::Sin,  0U, 0.000068 },
+					{ Component::Alpha, Trig::Sin,  1U, 0.000238 },
+					{ Component::Alpha, Trig::Sin,  2U, 0.000052 },
+					{ Component::Alpha, Trig::Sin,  3U, 0.000009 },
+					{ Component::Alpha, Trig::Sin,  4U, 0.419057 },
+					{ Component::Delta, Trig::Cos,  5U, 0.000051 },
+					{ Component::Delta, Trig::Cos,  6U, 0.000141 },
+					{ Component::Delta, Trig::Cos,  7U, 0.000031 },
+					{ Component::Delta, Trig::Cos,  8U, 0.000005 },
+					{ Component::Delta, Trig::Cos,  9U, 1.591274 },
+					{ Component::W,     Trig::Sin, 10U, 0.000145 },
+					{ Component::W,     Trig::Sin, 11U, 0.000157 },
+					{ Component::W,     Trig::Sin, 12U, 0.000040 },
+					{ Component::W,     Trig::Sin, 13U, 0.000001 },
+					{ Component::W,     Trig::Sin, 14U, 0.000001 },
+					{ Component::W,     Trig::Sin, 15U, 0.584542 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 5U, 10U> s_Jupiter {
+				{{
+					{ 268.056595, -0.006499, 0.0,         0.0 },
+					{  64.495303,  0.002413, 0.0,         0.0 },
+					{ 284.95,      0.0,      870.5360000, 0.0 }
+				}},
+				{{
+					{  99.360714, 4850.4046, 0.0, 0.0 },      // Ja
+					{ 175.895369, 1191.9605, 0.0, 0.0 },      // Jb
+					{ 300.323162,  262.5475, 0.0, 0.0 },      // Jc
+					{ 114.012305, 6070.2476, 0.0, 0.0 },      // Jd
+					{  49.511251,   64.3000, 0.0, 0.0 }       // Je
+				}},
+				{{
+					{ Component::Alpha, Trig::Sin, 0U,  0.000117 },
+					{ Component::Alpha, Trig::Sin, 1U,  0.000938 },
+					{ Component::Alpha, Trig::Sin, 2U,  0.001432 },
+					{ Component::Alpha, Trig::Sin, 3U,  0.000030 },
+					{ Component::Alpha, Trig::Sin, 4U,  0.002150 },
+					{ Component::Delta, Trig::Cos, 0U,  0.000050 },
+					{ Component::Delta, Trig::Cos, 1U,  0.000404 },
+					{ Component::Delta, Trig::Cos, 2U,  0.000617 },
+					{ Component::Delta, Trig::Cos, 3U, -0.000013 },
+					{ Component::Delta, Trig::Cos, 4U,  0.000926 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Saturn {
+				{{
+					{ 40.589, -0.036, 0.0,         0.0 },
+					{ 83.537, -0.004, 0.0,         0.0 },
+					{ 38.90,   0.0,   810.7939024, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Uranus {
+				{{
+					{ 257.311, 0.0,    0.0,         0.0 },
+					{ -15.175, 0.0,    0.0,         0.0 },
+					{ 203.81,  0.0, -501.1600928,   0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 1U, 3U> s_Neptune {
+				{{
+					{ 299.36,  0.0, 0.0,         0.0 },
+					{  43.46,  0.0, 0.0,         0.0 },
+					{ 249.978, 0.0, 541.1397757, 0.0 }
+				}},
+				{{
+					{ 357.85, 52.316, 0.0, 0.0 }              // N
+				}},
+				{{
+					{ Component::Alpha, Trig::Sin, 0U,  0.70 },
+					{ Component::Delta, Trig::Cos, 0U, -0.51 },
+					{ Component::W,     Trig::Sin, 0U, -0.48 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Sol(const T& _t) {
+				return Evaluate(s_Sol<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Sol() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Sol(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Sol<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Mercury(const T& _t) {
+				return Evaluate(s_Mercury<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Mercury() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Mercury(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Mercury<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Venus(const T& _t) {
+				return Evaluate(s_Venus<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Venus() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Venus(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Venus<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Mars(const T& _t) {
+				return Evaluate(s_Mars<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Mars() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Mars(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Mars<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Jupiter(const T& _t) {
+				return Evaluate(s_Jupiter<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Jupiter() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Jupiter(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Jupiter<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Saturn(const T& _t) {
+				return Evaluate(s_Saturn<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Saturn() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Saturn(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Saturn<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Uranus(const T& _t) {
+				return Evaluate(s_Uranus<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Uranus() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Uranus(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Uranus<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Neptune(const T& _t) {
+				return Evaluate(s_Neptune<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Neptune() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Neptune(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Neptune<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			/**
+			 * @brief Returns whether the report defines a model of a body.
+			 *
+			 * @tparam B The body.
+			 */
+			template<Body B>
+			static constexpr bool Provides() {
+				
+				return B == Body::Sol     ||
+				       B == Body::Mercury ||
+				       B == Body::Venus   ||
+				       B == Body::Mars    ||
+				       B == Body::Jupiter ||
+				       B == Body::Saturn  ||
+				       B == Body::Uranus  ||
+				       B == Body::Neptune;
+			}
+			
+			/**
+			 * @brief Returns the report's model of a body.
+			 *
+			 * @tparam B The body, which must satisfy Provides().
+			 * @return A reference to the model.
+			 */
+			template<Body B, typename T>
+			static constexpr const auto& GetModel() {
+				
+				static_assert(Provides<B>(), "The 2015 report does not define a model of this body.");
+				
+				     if constexpr (B == Body::Sol    ) { return s_Sol    <T>; }
+				else if constexpr (B == Body::Mercury) { return s_Mercury<T>; }
+				else if constexpr (B == Body::Venus  ) { return s_Venus  <T>; }
+				else if constexpr (B == Body::Mars   ) { return s_Mars   <T>; }
+				else if constexpr (B == Body::Jupiter) { return s_Jupiter<T>; }
+				else if constexpr (B == Body::Saturn ) { return s_Saturn <T>; }
+				else if constexpr (B == Body::Uranus ) { return s_Uranus <T>; }
+				else                                   { return s_Neptune<T>; }
+			}
+		};
+		
+		/**
+		 * @brief Provides orientations of astronomical objects as outlined in the 2009 WGCCRE report.
+		 *
+		 * @see https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2009reprint.pdf
+		 */
+		struct Report_2009 final {
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Earth {
+				{{
+					{   0.00,  -0.641, 0.0,         0.0 },
+					{  90.00,  -0.557, 0.0,         0.0 },
+					{ 190.147,  0.0,   360.9856235, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 13U, 28U> s_Moon {
+				{{
+					{ 269.9949, 0.0031, 0.0,          0.0     },
+					{  66.5392, 0.0130, 0.0,          0.0     },
+					{  38.3213, 0.0,    13.17635815, -1.4e-12 }
+				}},
+				{{
+					{ 125.045, 0.0, -0.0529921, 0.0 },        // E1
+					{ 250.089, 0.0, -0.1059842, 0.0 },        // E2
+					{ 260.008, 0.0, 13.0120009, 0.0 },        // E3
+					{ 176.625, 0.0, 13.3407154, 0.0 },        // E4
+					{ 357.529, 0.0,  0.9856003, 0.0 },        // E5
+					{ 311.589, 0.0, 26.4057084, 0.0 },        // E6
+					{ 134.963, 0.0, 13.0649930, 0.0 },        // E7
+					{ 276.617, 0.0,  0.3287146, 0.0 },        // E8
+					{  34.226, 0.0,  1.7484877, 0.0 },        // E9
+					{  15.134, 0.0, -0.1589763, 0.0 },        // E10
+					{ 119.743, 0.0,  0.0036096, 0.0 },        // E11
+					{ 239.961, 0.0,  0.1643573, 0.0 },        // E12
+					{  25.053, 0.0, 12.9590088, 0.0 }         // E13
+				}},
+				{{
+					{ Component::Alpha, Trig::Sin,  0U, -3.8787 },
+					{ Component::Alpha, Trig::Sin,  1U, -0.1204 },
+					{ Component::Alpha, Trig::Sin,  2U,  0.0700 },
+					{ Component::Alpha, Trig::Sin,  3U, -0.0172 },
+					{ Component::Alpha, Trig::Sin,  5U,  0.0072 },
+					{ Component::Alpha, Trig::Sin,  9U, -0.0052 },
+					{ Component::Alpha, Trig::Sin, 12U,  0.0043 },
+					{ Component::Delta, Trig::Cos,  0U,  1.5419 },
+					{ Component::Delta, Trig::Cos,  1U,  0.0239 },
+					{ Component::Delta, Trig::Cos,  2U, -0.0278 },
+					{ Component::Delta, Trig::Cos,  3U,  0.0068 },
+					{ Component::Delta, Trig::Cos,  5U, -0.0029 },
+					{ Component::Delta, Trig::Cos,  6U,  0.0009 },
+					{ Component::Delta, Trig::Cos,  9U,  0.0008 },
+					{ Component::Delta, Trig::Cos, 12U, -0.0009 },
+					{ Component::W,     Trig::Sin,  0U,  3.5610 },
+					{ Component::W,     Trig::Sin,  1U,  0.1208 },
+					{ Component::W,     Trig::Sin,  2U, -0.0642 },
+					{ Component::W,     Trig::Sin,  3U,  0.0158 },
+					{ Component::W,     Trig::Sin,  4U,  0.0252 },
+					{ Component::W,     Trig::Sin,  5U, -0.0066 },
+					{ Component::W,     Trig::Sin,  6U, -0.0047 },
+					{ Component::W,     Trig::Sin,  7U, -0.0046 },
+					{ Component::W,     Trig::Sin,  8U,  0.0028 },
+					{ Component::W,     Trig::Sin,  9U,  0.0052 },
+					{ Component::W,     Trig::Sin, 10U,  0.0040 },
+					{ Component::W,     Trig::Sin, 11U,  0.0019 },
+					{ Component::W,     Trig::Sin, 12U, -0.0044 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Mars {
+				{{
+					{ 317.68143, -0.1061, 0.0,          0.0 },
+					{  52.88650, -0.0609, 0.0,          0.0 },
+					{ 176.630,    0.0,    350.89198226, 0.0 }
+				}},
+				{},
+				{}
+			};
+
+			/**
+			 * @brief Arguments M1 to M3, shared by the satellites of Mars.
+			 */
+			template<typename T>
+			static constexpr std::array<Polynomial<T>, 3U> s_MarsSystem {{
+				{ 169.51, 0.0,   -0.4357640, 0.0                          },  // M1
+				{ 192.93, 0.0, 1128.4096700, 8.864 / (365250.0 * 365250.0) },  // M2
+				{  53.47, 0.0,   -0.0181510, 0.0                          }   // M3
+			}};
+			
+			/**
+			 * @brief Arguments J3 to J8, shared by the Galilean satellites.
+			 */
+			template<typename T>
+			static constexpr std::array<Polynomial<T>, 6U> s_JupiterSystem {{
+				{ 283.90, 4850.7, 0.0, 0.0 },                 // J3
+				{ 355.80, 1191.3, 0.0, 0.0 },                 // J4
+				{ 119.90,  262.1, 0.0, 0.0 },                 // J5
+				{ 229.80,   64.3, 0.0, 0.0 },                 // J6
+				{ 352.25, 2382.6, 0.0, 0.0 },                 // J7
+				{ 113.35, 6070.0, 0.0, 0.0 }                  // J8
+			}};
+			
+			/**
+			 * @brief Arguments S3 to S6, shared by the satellites of Saturn.
+			 */
+			template<typename T>
+			static constexpr std::array<Polynomial<T>, 4U> s_SaturnSystem {{
+				{ 177.40, -36505.5, 0.0, 0.0 },               // S3
+				{ 300.00,  -7225.9, 0.0, 0.0 },               // S4
+				{ 316.45,    506.2, 0.0, 0.0 },               // S5
+				{ 345.20,  -1016.3, 0.0, 0.0 }                // S6
+			}};
+			
+			template<typename T>
+			static constexpr Model<T, 3U, 4U> s_Phobos {
+				{{
+					{ 317.68, -0.108, 0.0,          0.0                          },
+					{  52.90, -0.061, 0.0,          0.0                          },
+					{  35.06,  0.0,   1128.8445850, 8.864 / (365250.0 * 365250.0) }
+				}},
+				s_MarsSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 0U,  1.79 },
+					{ Component::Delta, Trig::Cos, 0U, -1.08 },
+					{ Component::W,     Trig::Sin, 0U, -1.42 },
+					{ Component::W,     Trig::Sin, 1U, -0.78 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 3U, 4U> s_Deimos {
+				{{
+					{ 316.65, -0.108, 0.0,         0.0                           },
+					{  53.52, -0.061, 0.0,         0.0                           },
+					{  79.41,  0.0,   285.1618970, -0.520 / (365250.0 * 365250.0) }
+				}},
+				s_MarsSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 2U,  2.98 },
+					{ Component::Delta, Trig::Cos, 2U, -1.78 },
+					{ Component::W,     Trig::Sin, 2U, -2.58 },
+					{ Component::W,     Trig::Cos, 2U,  0.19 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 6U, 6U> s_Io {
+				{{
+					{ 268.05, -0.009, 0.0,         0.0 },
+					{  64.50,  0.003, 0.0,         0.0 },
+					{ 200.39,  0.0,   203.4889538, 0.0 }
+				}},
+				s_JupiterSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 0U,  0.094 },
+					{ Component::Alpha, Trig::Sin, 1U,  0.024 },
+					{ Component::Delta, Trig::Cos, 0U,  0.040 },
+					{ Component::Delta, Trig::Cos, 1U,  0.011 },
+					{ Component::W,     Trig::Sin, 0U, -0.085 },
+					{ Component::W,     Trig::Sin, 1U, -0.022 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 6U, 12U> s_Europa {
+				{{
+					{ 268.08,  -0.009, 0.0,         0.0 },
+					{  64.51,   0.003, 0.0,         0.0 },
+					{  36.022,  0.0,   101.3747235, 0.0 }
+				}},
+				s_JupiterSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 1U,  1.086 },
+					{ Component::Alpha, Trig::Sin, 2U,  0.060 },
+					{ Component::Alpha, Trig::Sin, 3U,  0.015 },
+					{ Component::Alpha, Trig::Sin, 4U,  0.009 },
+					{ Component::Delta, Trig::Cos, 1U,  0.468 },
+					{ Component::Delta, Trig::Cos, 2U,  0.026 },
+					{ Component::Delta, Trig::Cos, 3U,  0.007 },
+					{ Component::Delta, Trig::Cos, 4U,  0.002 },
+					{ Component::W,     Trig::Sin, 1U, -0.980 },
+					{ Component::W,     Trig::Sin, 2U, -0.054 },
+					{ Component::W,     Trig::Sin, 3U, -0.014 },
+					{ Component::W,     Trig::Sin, 4U, -0.008 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 6U, 9U> s_Ganymede {
+				{{
+					{ 268.20,  -0.009, 0.0,        0.0 },
+					{  64.57,   0.003, 0.0,        0.0 },
+					{  44.064,  0.0,   50.3176081, 0.0 }
+				}},
+				s_JupiterSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 1U, -0.037 },
+					{ Component::Alpha, Trig::Sin, 2U,  0.431 },
+					{ Component::Alpha, Trig::Sin, 3U,  0.091 },
+					{ Component::Delta, Trig::Cos, 1U, -0.016 },
+					{ Component::Delta, Trig::Cos, 2U,  0.186 },
+					{ Component::Delta, Trig::Cos, 3U,  0.039 },
+					{ Component::W,     Trig::Sin, 1U,  0.033 },
+					{ Component::W,     Trig::Sin, 2U, -0.389 },
+					{ Component::W,     Trig::Sin, 3U, -0.082 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 6U, 9U> s_Callisto {
+				{{
+					{ 268.72, -0.009, 0.0,        0.0 },
+					{  64.83,  0.003, 0.0,        0.0 },
+					{ 259.51,  0.0,   21.5710715, 0.0 }
+				}},
+				s_JupiterSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 2U, -0.068 },
+					{ Component::Alpha, Trig::Sin, 3U,  0.590 },
+					{ Component::Alpha, Trig::Sin, 5U,  0.010 },
+					{ Component::Delta, Trig::Cos, 2U, -0.029 },
+					{ Component::Delta, Trig::Cos, 3U,  0.254 },
+					{ Component::Delta, Trig::Cos, 5U, -0.004 },
+					{ Component::W,     Trig::Sin, 2U,  0.061 },
+					{ Component::W,     Trig::Sin, 3U, -0.533 },
+					{ Component::W,     Trig::Sin, 5U, -0.009 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 4U, 4U> s_Mimas {
+				{{
+					{  40.66, -0.036, 0.0,         0.0 },
+					{  83.52, -0.004, 0.0,         0.0 },
+					{ 333.46,  0.0,   381.9945550, 0.0 }
+				}},
+				s_SaturnSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 0U,  13.56 },
+					{ Component::Delta, Trig::Cos, 0U,  -1.53 },
+					{ Component::W,     Trig::Sin, 0U, -13.48 },
+					{ Component::W,     Trig::Sin, 2U, -44.85 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Enceladus {
+				{{
+					{ 40.66, -0.036, 0.0,         0.0 },
+					{ 83.52, -0.004, 0.0,         0.0 },
+					{  6.32,  0.0,   262.7318996, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 4U, 4U> s_Tethys {
+				{{
+					{ 40.66, -0.036, 0.0,         0.0 },
+					{ 83.52, -0.004, 0.0,         0.0 },
+					{  8.95,  0.0,   190.6979085, 0.0 }
+				}},
+				s_SaturnSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 1U,  9.66 },
+					{ Component::Delta, Trig::Cos, 1U, -1.09 },
+					{ Component::W,     Trig::Sin, 1U, -9.60 },
+					{ Component::W,     Trig::Sin, 2U,  2.23 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Dione {
+				{{
+					{  40.66, -0.036, 0.0,         0.0 },
+					{  83.52, -0.004, 0.0,         0.0 },
+					{ 357.6,   0.0,   131.5349316, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 4U, 3U> s_Rhea {
+				{{
+					{  40.38, -0.036, 0.0,        0.0 },
+					{  83.55, -0.004, 0.0,        0.0 },
+					{ 235.16,  0.0,   79.6900478, 0.0 }
+				}},
+				s_SaturnSystem<T>,
+				{{
+					{ Component::Alpha, Trig::Sin, 3U,  3.10 },
+					{ Component::Delta, Trig::Cos, 3U, -0.35 },
+					{ Component::W,     Trig::Sin, 3U, -3.08 }
+				}}
+			};
+			
+			template<typename T>
+			static constexpr Model<T, 0U, 0U> s_Titan {
+				{{
+					{  39.4827, 0.0,  0.0,        0.0 },
+					{  83.4279, 0.0,  0.0,        0.0 },
+					{ 186.5855, 0.0, 22.5769768, 0.0 }
+				}},
+				{},
+				{}
+			};
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Earth(const T& _t) {
+				return Evaluate(s_Earth<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Earth() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Earth(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Earth<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Moon(const T& _t) {
+				return Evaluate(s_Moon<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Moon() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Moon(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Moon<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Mars(const T& _t) {
+				return Evaluate(s_Mars<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Mars() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Mars(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Mars<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Phobos(const T& _t) {
+				return Evaluate(s_Phobos<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Phobos() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Phobos(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Phobos<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Deimos(const T& _t) {
+				return Evaluate(s_Deimos<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Deimos() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Deimos(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Deimos<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Io(const T& _t) {
+				return Evaluate(s_Io<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Io() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Io(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Io<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Europa(const T& _t) {
+				return Evaluate(s_Europa<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Europa() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Europa(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Europa<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Ganymede(const T& _t) {
+				return Evaluate(s_Ganymede<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Ganymede() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Ganymede(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Ganymede<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Callisto(const T& _t) {
+				return Evaluate(s_Callisto<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Callisto() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Callisto(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Callisto<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Mimas(const T& _t) {
+				return Evaluate(s_Mimas<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Mimas() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Mimas(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Mimas<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Enceladus(const T& _t) {
+				return Evaluate(s_Enceladus<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Enceladus() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Enceladus(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Enceladus<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Tethys(const T& _t) {
+				return Evaluate(s_Tethys<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Tethys() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Tethys(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Tethys<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Dione(const T& _t) {
+				return Evaluate(s_Dione<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Dione() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Dione(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Dione<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Rhea(const T& _t) {
+				return Evaluate(s_Rhea<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Rhea() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Rhea(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Rhea<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			template<typename T>
+			static constexpr std::array<T, 3U> Titan(const T& _t) {
+				return Evaluate(s_Titan<T>, _t);
+			}
+			
+			/**
+			 * @brief Batched variant of Titan() writing alpha, delta and W into separate arrays.
+			 */
+			template<typename T>
+			static void Titan(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				Evaluate(s_Titan<T>, _t, _count, _alpha, _delta, _W);
+			}
+			
+			/**
+			 * @brief Returns whether the report defines a model of a body.
+			 *
+			 * @tparam B The body.
+			 */
+			template<Body B>
+			static constexpr bool Provides() {
+				
+				return B == Body::Earth     ||
+				       B == Body::Moon      ||
+				       B == Body::Mars      ||
+				       B == Body::Phobos    ||
+				       B == Body::Deimos    ||
+				       B == Body::Io        ||
+				       B == Body::Europa    ||
+				       B == Body::Ganymede  ||
+				       B == Body::Callisto  ||
+				       B == Body::Mimas     ||
+				       B == Body::Enceladus ||
+				       B == Body::Tethys    ||
+				       B == Body::Dione     ||
+				       B == Body::Rhea      ||
+				       B == Body::Titan;
+			}
+			
+			/**
+			 * @brief Returns the report's model of a body.
+			 *
+			 * @tparam B The body, which must satisfy Provides().
+			 * @return A reference to the model.
+			 */
+			template<Body B, typename T>
+			static constexpr const auto& GetModel() {
+				
+				static_assert(Provides<B>(), "The 2009 report does not define a model of this body.");
+				
+				     if constexpr (B == Body::Earth    ) { return s_Earth    <T>; }
+				else if constexpr (B == Body::Moon     ) { return s_Moon     <T>; }
+				else if constexpr (B == Body::Mars     ) { return s_Mars     <T>; }
+				else if constexpr (B == Body::Phobos   ) { return s_Phobos   <T>; }
+				else if constexpr (B == Body::Deimos   ) { return s_Deimos   <T>; }
+				else if constexpr (B == Body::Io       ) { return s_Io       <T>; }
+				else if constexpr (B == Body::Europa   ) { return s_Europa   <T>; }
+				else if constexpr (B == Body::Ganymede ) { return s_Ganymede <T>; }
+				else if constexpr (B == Body::Callisto ) { return s_Callisto <T>; }
+				else if constexpr (B == Body::Mimas    ) { return s_Mimas    <T>; }
+				else if constexpr (B == Body::Enceladus) { return s_Enceladus<T>; }
+				else if constexpr (B == Body::Tethys   ) { return s_Tethys   <T>; }
+				else if constexpr (B == Body::Dione    ) { return s_Dione    <T>; }
+				else if constexpr (B == Body::Rhea     ) { return s_Rhea     <T>; }
+				else                                     { return s_Titan    <T>; }
+			}
+		};
+		
+		/**
+		 * @brief Evaluates orientations using the models selected by a policy rather than DefaultReports.
+		 *
+		 * @details Each function resolves to the same direct evaluation as its counterpart in WGCCRE, so pinning a model
+		 * costs nothing at runtime.
+		 *
+		 * @code
+		 * using Pinned = WGCCRE::Registry<WGCCRE::Reports<WGCCRE::Report_2009, WGCCRE::Report_2015>>;
+		 *
+		 * const auto mars = Pinned::GetOrientation<WGCCRE::Body::Mars>(0.0); // 2009 model.
+		 * @endcode
+		 *
+		 * @tparam P The policy, e.g. an instance of Reports.
+		 */
+		template<typename P>
+		struct Registry final {
+			
+			/**
+			 * @brief Returns the rotational model the policy selects for a body.
+			 *
+			 * @tparam B The body.
+			 * @return A reference to the model.
+			 */
+			template<Body B, typename T>
+			static constexpr const auto& GetModel() {
+				return P::template GetModel<B, T>();
+			}
+			
+			/**
+			 * @brief Returns the orientation of a body in the frame of the report it is sourced from.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation of the body as alpha, delta and W (degrees).
+			 */
+			template<Body B, typename T>
+			static constexpr std::array<T, 3U> GetOrientation(const T& _t) {
+				
+				CountEvaluation(B);
+				
+				return Evaluate(GetModel<B, T>(), _t);
+			}
+			
+			/**
+			 * @brief Variant of GetOrientation() taking a split epoch.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation of the body as alpha, delta and W (degrees), with W reduced modulo 360.
+			 */
+			template<Body B, typename T>
+			static constexpr std::array<T, 3U> GetOrientation(const SplitEpoch<T>& _t) {
+				
+				CountEvaluation(B);
+				
+				return Evaluate(GetModel<B, T>(), _t);
+			}
+			
+			/**
+			 * @brief Batched variant of GetOrientation() writing alpha, delta and W into separate arrays.
+			 */
+			template<Body B, typename T>
+			static void GetOrientation(const T* _t, const std::size_t& _count, T* _alpha, T* _delta, T* _W) {
+				
+				const BatchScope scope(B, _count);
+				
+				Evaluate(GetModel<B, T>(), _t, _count, _alpha, _delta, _W);
+			}
+			
+			/**
+			 * @brief Returns the orientation of a body for use with VSOP87.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation of the body in the VSOP87 frame.
+			 */
+			template<Body B, typename T>
+			static constexpr std::array<T, 3U> GetOrientationVSOP87(const T& _t) {
+				
+				CountEvaluation(B);
+				
+				return WrapVSOP87(Evaluate(s_VSOP87<B, T, P>, _t));
+			}
+			
+			/**
+			 * @brief Variant of GetOrientationVSOP87() taking a split epoch.
+			 */
+			template<Body B, typename T>
+			static constexpr std::array<T, 3U> GetOrientationVSOP87(const SplitEpoch<T>& _t) {
+				
+				CountEvaluation(B);
+				
+				return WrapVSOP87(Evaluate(s_VSOP87<B, T, P>, _t));
+			}
+			
+			/**
+			 * @brief Batched variant of GetOrientationVSOP87() writing each component into a separate array.
+			 */
+			template<Body B, typename T>
+			static void GetOrientationVSOP87(const T* _t, const std::size_t& _count, T* _x, T* _y, T* _z) {
+				
+				const BatchScope scope(B, _count);
+				
+				EvaluateVSOP87(s_VSOP87<B, T, P>, _t, _count, _x, _y, _z);
+			}
+			
+			/**
+			 * @brief Returns the orientation of a body together with its analytic rates of change.
+			 *
+			 * @tparam B The body.
+			 * @param[in] _t The epoch.
+			 * @return The orientation as alpha, delta and W (degrees), and their rates in degrees per Julian millennium.
+			 */
+			template<Body B, typename T>
+			static constexpr State<T> GetState(const T& _t) {
+				return WGCCRE::GetState<B, T, P>(_t);
+			}
+			
+			/**
+			 * @brief Variant of GetState() taking a split epoch.
+			 */
+			template<Body B, typename T>
+			static constexpr State<T> GetState(const SplitEpoch<T>& _t) {
+				return WGCCRE::GetState<B, T, P>(_t);
+			}
+			
+			/**
+			 * @brief Returns the orientations of every Body at one epoch.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The orientations, indexed by Body.
+			 */
+			template<typename T>
+			static constexpr Orientations<T> GetAllOrientations(const T& _t) {
+				return WGCCRE::GetAllOrientations<T, P>(_t);
+			}
+			
+			/**
+			 * @brief Returns the orientations of every Body at one epoch, for use with VSOP87.
+			 *
+			 * @param[in] _t The epoch.
+			 * @return The orientations in the VSOP87 frame, indexed by Body.
+			 */
+			template<typename T>
+			static constexpr Orientations<T> GetAllOrientationsVSOP87(const T& _t) {
+				return WGCCRE::GetAllOrientationsVSOP87<T, P>(_t);
+			}
+			
+			/**
+			 * @brief Evaluates a set of bodies over an evenly-spaced range of epochs, dividing the range between threads.
+			 *
+			 * @see WGCCRE::Generate()
+			 */
+			template<typename T>
+			static void Generate(const Body* _bodies, const std::size_t& _body_count, const T& _begin, const T& _step, const std::size_t& _count, T* _out, const std::size_t& _threads = 0U) {
+				WGCCRE::Generate<T, P>(_bodies, _body_count, _begin, _step, _count, _out, _threads);
+			}
+			
+#if defined(LOUIERIKSSON_WGCCRE_COROUTINES)
+			
+			/**
+			 * @brief Returns a coroutine lazily yielding batches of orientations of a set of bodies over evenly-spaced epochs.
+			 *
+			 * @see WGCCRE::Generate()
+			 */
+			template<typename T>
+			static Generator<T> Generate(std::vector<Body> _bodies, T _begin, T _step, std::size_t _count, std::size_t _size = 1024U) {
+				return WGCCRE::Generate<T, P>(std::move(_bodies), _begin, _step, _count, _size);
+			}
+#endif
+			
+			/**
+			 * @brief Creates a Stepper for a body.
+			 *
+			 * @see WGCCRE::GetStepper()
+			 */
+			template<Body B, typename T>
+			static auto GetStepper(const T& _t, const T& _dt, const std::size_t& _interval = 256U) {
+				return WGCCRE::GetStepper<B, T, P>(_t, _dt, _interval);
+			}
+			
+			/**
+			 * @brief Creates a Chebyshev approximation of a body's orientation over a window of epochs.
+			 *
+			 * @see WGCCRE::GetChebyshev()
+			 */
+			template<Body B, std::size_t K = 12U, typename T>
+			static Chebyshev<T, K> GetChebyshev(const T& _begin, const T& _end, const T& _segment, const T& _tolerance) {
+				return WGCCRE::GetChebyshev<B, K, P>(_begin, _end, _segment, _tolerance);
+			}
+			
+			/**
+			 * @brief Creates a LookupTable of a body's orientation around an epoch.
+			 *
+			 * @see WGCCRE::GetLookupTable()
+			 */
+			template<Body B, typename T>
+			static LookupTable<T> GetLookupTable(const T& _centre, const T& _radius, const T& _step) {
+				return WGCCRE::GetLookupTable<B, T, P>(_centre, _radius, _step);
+			}
+			
+			/**
+			 * @brief Creates a Recentred model of a body.
+			 *
+			 * @see WGCCRE::GetRecentred()
+			 */
+			template<Body B, typename T = float>
+			static constexpr auto GetRecentred(const double& _epoch) {
+				return WGCCRE::GetRecentred<B, T, P>(_epoch);
+			}
+			
+			/**
+			 * @brief Packs the rotational model of a body into the flat layout read by s_KernelSource.
+			 *
+			 * @see WGCCRE::GetPackedModel()
+			 */
+			template<Body B, typename T>
+			static constexpr auto GetPackedModel() {
+				return WGCCRE::GetPackedModel<B, T, P>();
+			}
+			
+			/** @brief A Cache of the models selected by the policy. */
+			template<typename T, std::size_t N = 4U>
+			using Cache = WGCCRE::Cache<T, N, P>;
+			
+			/**
+			 * @brief Returns a Cache of the models selected by the policy, private to the calling thread.
+			 */
+			template<typename T, std::size_t N = 4U>
+			static Cache<T, N>& GetThreadCache() {
+				return WGCCRE::GetThreadCache<T, N, P>();
+			}
+			
+			/** @brief The satellite System of a planet, using the models selected by the policy. */
+			template<Body B, typename T>
+			using System = WGCCRE::System<B, T, P>;
+			
+			/** @brief A Stream of the models selected by the policy. */
+			template<typename T>
+			using Stream = WGCCRE::Stream<T, P>;
+			
+			/** @brief A TableWriter of the models selected by the policy. */
+			template<typename T>
+			using TableWriter = WGCCRE::TableWriter<T, P>;
+			
+			/** @brief A TableReader of tables written with the models selected by the policy. */
+			template<typename T>
+			using TableReader = WGCCRE::TableReader<T, P>;
+			
+#if defined(LOUIERIKSSON_WGCCRE_OPENCL)
+			
+			/** @brief An OpenCL Device evaluating the models selected by the policy. */
+			template<typename T>
+			using Device = WGCCRE::Device<T, P>;
+#endif
 		};
 	};
 	
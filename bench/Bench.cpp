@@ -0,0 +1,317 @@
+/**
+ * @file Bench.cpp
+ * @brief Measures the throughput of every body's evaluators in each precision, and their error against Reference.
+ *
+ * @details Run without arguments to print both tables. With <tt>--accuracy</tt> or <tt>--throughput</tt>, only that
+ * table is printed. The exit status reports whether any error exceeds the tolerance of its precision, and whether the
+ * totals of the throughput table fall outside the bounds of CheckThroughput(). Those bounds are ratios between timings
+ * taken in the same run, so that they hold on any machine.
+ */
+
+#include "Measure.hpp"
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Bench::Consume;
+	using LouiEriksson::Bench::Measure;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/** @brief The number of distinct epochs each measurement cycles through. */
+	constexpr std::size_t s_Epochs = 4096U;
+	
+	/** @brief The largest acceptable ratio of the scalar evaluators' total time to Reference's, in double. */
+	constexpr double s_ScalarBound = 0.6;
+	
+	/** @brief The largest acceptable ratio of a total in float to the same total in double. */
+	constexpr double s_FloatBound = 1.5;
+	
+	/**
+	 * @brief Returns the epochs a precision is measured over, in Julian millennia since J2000.0.
+	 *
+	 * @details Float holds W to a useful precision only within a few months of J2000.0, so it is measured there.
+	 */
+	template<typename T>
+	std::vector<T> GetEpochs() {
+		
+		const long double span = std::is_same_v<T, float> ? 3.0e-4L : 0.1L;
+		
+		std::vector<T> result(s_Epochs);
+		for (std::size_t i = 0U; i < result.size(); ++i) {
+			result[i] = static_cast<T>(-span + ((2.0L * span) * static_cast<long double>(i) / static_cast<long double>(result.size() - 1U)));
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Returns the largest acceptable error of a precision over the epochs of GetEpochs() (degrees).
+	 */
+	template<typename T>
+	constexpr long double GetTolerance() {
+		
+		if constexpr (std::is_same_v<T, float>) {
+			return 5.0e-2L;
+		}
+		else if constexpr (std::is_same_v<T, double>) {
+			return 1.0e-7L;
+		}
+		else {
+			return 1.0e-8L;
+		}
+	}
+	
+	/**
+	 * @brief Returns the name of a precision, for the tables.
+	 */
+	template<typename T>
+	constexpr const char* GetTypeName() {
+		
+		if constexpr (std::is_same_v<T, float>) {
+			return "float";
+		}
+		else if constexpr (std::is_same_v<T, double>) {
+			return "double";
+		}
+		else {
+			return "long double";
+		}
+	}
+	
+	/**
+	 * @brief Returns the name of an instruction set, for the tables.
+	 */
+	const char* GetName(const WGCCRE::InstructionSet& _set) {
+		
+		switch (_set) {
+			case WGCCRE::InstructionSet::Scalar: { return "Scalar"; }
+			case WGCCRE::InstructionSet::SSE2:   { return "SSE2";   }
+			case WGCCRE::InstructionSet::AVX:    { return "AVX";    }
+			case WGCCRE::InstructionSet::NEON:   { return "NEON";   }
+			case WGCCRE::InstructionSet::AVX2:   { return "AVX2";   }
+			case WGCCRE::InstructionSet::AVX512: { return "AVX512"; }
+			default: {
+				return "Unknown";
+			}
+		}
+	}
+	
+	/**
+	 * @brief Times of one evaluation of every body, summed over the bodies (nanoseconds).
+	 */
+	struct Totals final {
+		
+		/** @brief The scalar evaluator. */
+		double scalar;
+		
+		/** @brief The batched evaluator, per epoch. */
+		double batch;
+		
+		/** @brief The transcription of Reference in the same precision, which calls std::sin and std::cos per term. */
+		double reference;
+	};
+	
+	/**
+	 * @brief Returns the largest acceptable ratio of the batched evaluators' total time per epoch to Reference's, in
+	 * double, when batches run on an instruction set.
+	 *
+	 * @details The 256-bit and 512-bit kernels evaluate four to eight times as many angles per instruction as SSE2.
+	 */
+	constexpr double GetBatchBound(const WGCCRE::InstructionSet& _set) {
+		return _set == WGCCRE::InstructionSet::AVX2 || _set == WGCCRE::InstructionSet::AVX512 ? 0.15 : 0.5;
+	}
+	
+	/**
+	 * @brief Measures and prints the scalar, name lookup and batched evaluators of every body in \p T, and Reference.
+	 *
+	 * @return The totals of the table.
+	 */
+	template<typename T>
+	Totals Throughput() {
+		
+		const auto epochs = GetEpochs<T>();
+		
+		std::vector<T> alpha(epochs.size()), delta(epochs.size()), W(epochs.size());
+		
+		Totals result { 0.0, 0.0, 0.0 };
+		
+		std::printf("\n%s\n", GetTypeName<T>());
+		std::printf("%-10s %12s %14s %12s %14s %12s %14s %12s\n", "body", "scalar ns", "scalar /s", "name ns", "name /s", "batch ns", "batch /s", "reference ns");
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto name = WGCCRE::GetName(body);
+			
+			const double scalar = Measure([&]() {
+				
+				for (const auto& t : epochs) {
+					Consume(WGCCRE::GetOrientation<body>(t)[2]);
+				}
+			}, epochs.size());
+			
+			const double lookup = Measure([&]() {
+				
+				for (const auto& t : epochs) {
+					Consume(WGCCRE::GetOrientationVSOP87(name, t)[2]);
+				}
+			}, epochs.size());
+			
+			const double batch = Measure([&]() {
+				
+				WGCCRE::GetOrientation<body>(epochs.data(), epochs.size(), alpha.data(), delta.data(), W.data());
+				
+				Consume(W.back());
+			}, epochs.size());
+			
+			const double reference = Measure([&]() {
+				
+				for (const auto& t : epochs) {
+					Consume((*Reference::GetOrientation(name, t))[2]);
+				}
+			}, epochs.size());
+			
+			std::printf("%-10.*s %12.2f %14.4g %12.2f %14.4g %12.2f %14.4g %12.2f\n",
+				static_cast<int>(name.size()), name.data(),
+				scalar, 1.0e9 / scalar,
+				lookup, 1.0e9 / lookup,
+				batch,  1.0e9 / batch,
+				reference
+			);
+			
+			result.scalar    += scalar;
+			result.batch     += batch;
+			result.reference += reference;
+		});
+		
+		std::printf("%-10s %12.2f %14s %12s %14s %12.2f %14s %12.2f\n", "total", result.scalar, "", "", "", result.batch, "", result.reference);
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Prints and checks a ratio of two totals against its bound.
+	 *
+	 * @param[in] _label What the ratio compares.
+	 * @param[in] _ratio The ratio.
+	 * @param[in] _bound The largest acceptable ratio.
+	 * @return Whether the ratio is within its bound.
+	 */
+	bool CheckRatio(const char* _label, const double& _ratio, const double& _bound) {
+		
+		const bool result = _ratio <= _bound;
+		
+		std::printf("%-34s %8.3f %8.3f%s\n", _label, _ratio, _bound, result ? "" : "  exceeds bound");
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Checks the totals of the float and double throughput tables against each other and against Reference.
+	 *
+	 * @details The bounds are at least twice the ratios the evaluators reach, but tight enough that losing the
+	 * vectorisation of the kernel, or sending whole evaluations to a narrower kernel, exceeds them.
+	 *
+	 * @param[in] _float The totals in float.
+	 * @param[in] _double The totals in double.
+	 * @return Whether every ratio is within its bound.
+	 */
+	bool CheckThroughput(const Totals& _float, const Totals& _double) {
+		
+		std::printf("\n%-34s %8s %8s\n", "ratio", "value", "bound");
+		
+		const double batch_bound = GetBatchBound(WGCCRE::GetInstructionSet());
+		
+		bool result = true;
+		
+		result = CheckRatio("double scalar / double reference", _double.scalar / _double.reference, s_ScalarBound) && result;
+		result = CheckRatio("double batch / double reference",  _double.batch  / _double.reference, batch_bound  ) && result;
+		result = CheckRatio("float scalar / double scalar",     _float.scalar  / _double.scalar,    s_FloatBound ) && result;
+		result = CheckRatio("float batch / double batch",       _float.batch   / _double.batch,     s_FloatBound ) && result;
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Measures and prints the largest error of every body's scalar and batched evaluators in \p T.
+	 *
+	 * @return Whether every error is within GetTolerance().
+	 */
+	template<typename T>
+	bool Accuracy() {
+		
+		const auto epochs = GetEpochs<T>();
+		
+		std::vector<T> alpha(epochs.size()), delta(epochs.size()), W(epochs.size());
+		
+		bool result = true;
+		
+		std::printf("\n%s, tolerance %.1Le degrees\n", GetTypeName<T>(), GetTolerance<T>());
+		std::printf("%-10s %14s %14s\n", "body", "scalar error", "batch error");
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto name = WGCCRE::GetName(body);
+			
+			WGCCRE::GetOrientation<body>(epochs.data(), epochs.size(), alpha.data(), delta.data(), W.data());
+			
+			long double scalar = 0.0L, batch = 0.0L;
+			
+			for (std::size_t i = 0U; i < epochs.size(); ++i) {
+				
+				const auto expected = *Reference::GetOrientation(name, static_cast<long double>(epochs[i]));
+				
+				scalar = std::max(scalar, AngularDistance(WGCCRE::GetOrientation<body>(epochs[i]), expected));
+				batch  = std::max(batch,  AngularDistance(std::array<T, 3U> { alpha[i], delta[i], W[i] }, expected));
+			}
+			
+			const bool good = scalar <= GetTolerance<T>() && batch <= GetTolerance<T>();
+			
+			std::printf("%-10.*s %14.3Le %14.3Le%s\n", static_cast<int>(name.size()), name.data(), scalar, batch, good ? "" : "  exceeds tolerance");
+			
+			result = result && good;
+		});
+		
+		return result;
+	}
+
+} // namespace
+
+int main(int _argc, char* _argv[]) {
+	
+	const bool accuracy   = _argc < 2 || std::strcmp(_argv[1], "--accuracy")   == 0;
+	const bool throughput = _argc < 2 || std::strcmp(_argv[1], "--throughput") == 0;
+	
+	std::printf("Instruction set: %s\n", GetName(WGCCRE::GetInstructionSet()));
+	
+	bool good = true;
+	
+	if (throughput) {
+		
+		const auto f = Throughput<float>();
+		const auto d = Throughput<double>();
+		
+		Throughput<long double>();
+		
+		good = CheckThroughput(f, d) && good;
+	}
+	
+	if (accuracy) {
+		
+		good = Accuracy<float>()       && good;
+		good = Accuracy<double>()      && good;
+		good = Accuracy<long double>() && good;
+	}
+	
+	return good ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file Folding.cpp
+ * @brief Compares evaluating the models with their daily rates and the degree-to-radian factor folded into the
+ * coefficients against the evaluation they replaced.
+ *
+ * @details Both evaluators are transcribed here over the library's double models, so that they differ only in the
+ * folding. The unfolded one computes the epoch in days on each call and evaluates each polynomial term by term, and
+ * its sincos converts the reduced angle to radians before its minimax polynomials. The folded one evaluates each
+ * polynomial in Horner form from Rate() and Acceleration(), and its minimax coefficients are scaled by powers of the
+ * degree-to-radian factor, as the library does.
+ *
+ * Folding saves one multiplication per polynomial and per angle, which is lost among the cost of the sines: only the
+ * bodies without periodic terms are measurably faster, by under a nanosecond, and the totals are within noise of each
+ * other. The library keeps the folded form because each polynomial is then one Horner evaluation in the epoch, with no
+ * epoch in days to carry alongside it, and its errors are of the same order.
+ */
+
+#include "Measure.hpp"
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Bench::Consume;
+	using LouiEriksson::Bench::Measure;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	constexpr long double s_D2R = 3.14159265358979323846264338327950288L / 180.0L;
+	
+	/** @brief Minimax coefficients of the sine over the octant, in radians. */
+	constexpr std::array<long double, 6U> s_Sin {
+		-1.66666666666666324348e-01L,
+		 8.33333333332248946124e-03L,
+		-1.98412698298579493134e-04L,
+		 2.75573137070700676789e-06L,
+		-2.50507602534068634195e-08L,
+		 1.58969099521155010221e-10L
+	};
+	
+	/** @brief Minimax coefficients of the cosine over the octant, in radians. */
+	constexpr std::array<long double, 7U> s_Cos {
+		-0.5L,
+		 4.16666666666666019037e-02L,
+		-1.38888888888741095749e-03L,
+		 2.48015872894767294178e-05L,
+		-2.75573143513906633035e-07L,
+		 2.08757232129817482790e-09L,
+		-1.13596475577881948265e-11L
+	};
+	
+	/**
+	 * @brief Returns a coefficient of a polynomial in radians as the coefficient of the same power in degrees.
+	 *
+	 * @param[in] _c The coefficient.
+	 * @param[in] _n The power it multiplies.
+	 */
+	constexpr double Fold(const long double& _c, const std::size_t& _n) {
+		
+		long double result = _c;
+		for (std::size_t i = 0U; i < _n; ++i) {
+			result *= s_D2R;
+		}
+		
+		return static_cast<double>(result);
+	}
+	
+	/**
+	 * @brief Returns coefficients of a polynomial in radians, in double.
+	 */
+	template<std::size_t N>
+	constexpr std::array<double, N> Radians(const std::array<long double, N>& _c) {
+		
+		std::array<double, N> result{};
+		for (std::size_t i = 0U; i < N; ++i) {
+			result[i] = static_cast<double>(_c[i]);
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Evaluates a polynomial in \p _z, skipping its first \p _skip coefficients.
+	 */
+	template<std::size_t N>
+	constexpr double Horner(const std::array<double, N>& _c, const double& _z, const std::size_t& _skip = 0U) {
+		
+		double result = _c[N - 1U];
+		for (std::size_t i = N - 1U; i-- > _skip;) {
+			result = (result * _z) + _c[i];
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Returns the sum of the components of an orientation, so that none of them can be discarded as unused.
+	 */
+	constexpr double Sum(const std::array<double, 3U>& _o) {
+		return _o[0] + _o[1] + _o[2];
+	}
+	
+	/**
+	 * @brief Evaluates a model at a single epoch, with or without the coefficients folded.
+	 *
+	 * @tparam F Whether the coefficients are folded.
+	 */
+	template<bool F>
+	struct Evaluator final {
+		
+		/**
+		 * @brief Calculates the sine and cosine of an angle in degrees.
+		 */
+		static void sincos_d(const double& _x, double& _sin, double& _cos) {
+			
+			const double q = std::round(_x * (1.0 / 90.0));
+			
+			double s = 0.0, c = 0.0;
+			
+			if constexpr (F) {
+				
+				constexpr std::array<double, 6U> S { Fold(s_Sin[0],  3U), Fold(s_Sin[1],  5U), Fold(s_Sin[2],  7U), Fold(s_Sin[3],  9U), Fold(s_Sin[4], 11U), Fold(s_Sin[5], 13U) };
+				constexpr std::array<double, 7U> C { Fold(s_Cos[0],  2U), Fold(s_Cos[1],  4U), Fold(s_Cos[2],  6U), Fold(s_Cos[3],  8U), Fold(s_Cos[4], 10U), Fold(s_Cos[5], 12U), Fold(s_Cos[6], 14U) };
+				
+				constexpr double D2R = Fold(1.0L, 1U);
+				
+				const double u = _x - (q * 90.0);
+				const double z = u * u;
+				
+				s = ((u * z) * Horner(S, z)) + (u * D2R);
+				c = ((z * z) * Horner(C, z, 1U)) + ((z * C[0]) + 1.0);
+			}
+			else {
+				
+				constexpr auto S = Radians(s_Sin);
+				constexpr auto C = Radians(s_Cos);
+				
+				constexpr double D2R = static_cast<double>(s_D2R);
+				
+				const double r = (_x - (q * 90.0)) * D2R;
+				const double z = r * r;
+				
+				s = ((r * z) * Horner(S, z)) + r;
+				c = ((z * z) * Horner(C, z, 1U)) + ((z * C[0]) + 1.0);
+			}
+			
+			// Odd quadrants swap sine and cosine; quadrants 2 and 3 negate the sine, and 1 and 2 the cosine. This is done
+			// without branches, as the library's kernel does, since the quadrants of most arguments change too quickly
+			// between epochs to be predicted, and mispredictions would otherwise dominate the timings.
+			const auto q4 = static_cast<std::size_t>(static_cast<std::int64_t>(q) & 3);
+			
+			const std::array<double, 2U> v { s, c };
+			
+			_sin = v[q4 & 1U]        * (1.0 - (2.0 * static_cast<double>( q4       >> 1U)));
+			_cos = v[(q4 & 1U) ^ 1U] * (1.0 - (2.0 * static_cast<double>(((q4 + 1U) >> 1U) & 1U)));
+		}
+		
+		/**
+		 * @brief Evaluates a polynomial of a model.
+		 *
+		 * @param[in] _p The polynomial.
+		 * @param[in] _t The epoch.
+		 * @param[in] _days The epoch in days, used only if the coefficients are not folded.
+		 */
+		static double Evaluate(const WGCCRE::Polynomial<double>& _p, const double& _t, const double& _days) {
+			
+			if constexpr (F) {
+				return _p.c0 + (_t * (_p.Rate() + (_t * _p.Acceleration())));
+			}
+			else {
+				return _p.c0 + (_p.t * _t) + (_p.d * _days) + (_p.d2 * (_days * _days));
+			}
+		}
+		
+		/**
+		 * @brief Evaluates a model at a single epoch.
+		 *
+		 * @param[in] _model The model.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees).
+		 */
+		template<std::size_t A, std::size_t N>
+		static std::array<double, 3U> Evaluate(const WGCCRE::Model<double, A, N>& _model, const double& _t) {
+			
+			const double days = F ? 0.0 : _t * 365250.0;
+			
+			std::array<double, 3U> result{};
+			for (std::size_t i = 0U; i < 3U; ++i) {
+				result[i] = Evaluate(_model.base[i], _t, days);
+			}
+			
+			if constexpr (A > 0U) {
+				
+				std::array<double, A> s{}, c{};
+				for (std::size_t i = 0U; i < A; ++i) {
+					sincos_d(Evaluate(_model.arguments[i], _t, days), s[i], c[i]);
+				}
+				
+				for (const auto& term : _model.terms) {
+					result[static_cast<std::size_t>(term.component)] += term.amplitude * (term.function == WGCCRE::Trig::Sin ? s[term.argument] : c[term.argument]);
+				}
+			}
+			
+			return result;
+		}
+	};
+
+} // namespace
+
+int main() {
+	
+	// A century either side of J2000.0.
+	std::vector<double> epochs(4096U);
+	for (std::size_t i = 0U; i < epochs.size(); ++i) {
+		epochs[i] = -0.1 + (0.2 * static_cast<double>(i) / static_cast<double>(epochs.size() - 1U));
+	}
+	
+	std::printf("%-10s %12s %12s %9s %14s %14s\n", "body", "unfolded ns", "folded ns", "speedup", "unfolded error", "folded error");
+	
+	double unfolded_total = 0.0, folded_total = 0.0;
+	
+	LouiEriksson::Test::ForEachBody([&](auto _b) {
+		
+		constexpr auto body = decltype(_b)::value;
+		
+		const auto name = WGCCRE::GetName(body);
+		
+		constexpr const auto& model = WGCCRE::Registry<WGCCRE::DefaultReports>::GetModel<body, double>();
+		
+		const double unfolded = Measure([&]() {
+			
+			for (const auto& t : epochs) {
+				Consume(Sum(Evaluator<false>::Evaluate(model, t)));
+			}
+		}, epochs.size());
+		
+		const double folded = Measure([&]() {
+			
+			for (const auto& t : epochs) {
+				Consume(Sum(Evaluator<true>::Evaluate(model, t)));
+			}
+		}, epochs.size());
+		
+		long double unfolded_error = 0.0L, folded_error = 0.0L;
+		
+		for (const auto& t : epochs) {
+			
+			const auto expected = *Reference::GetOrientation(name, static_cast<long double>(t));
+			
+			unfolded_error = std::max(unfolded_error, AngularDistance(Evaluator<false>::Evaluate(model, t), expected));
+			folded_error   = std::max(folded_error,   AngularDistance(Evaluator<true >::Evaluate(model, t), expected));
+		}
+		
+		std::printf("%-10.*s %12.2f %12.2f %8.2fx %14.3Le %14.3Le\n", static_cast<int>(name.size()), name.data(), unfolded, folded, unfolded / folded, unfolded_error, folded_error);
+		
+		unfolded_total += unfolded;
+		folded_total   += folded;
+	});
+	
+	std::printf("%-10s %12.2f %12.2f %8.2fx\n", "total", unfolded_total, folded_total, unfolded_total / folded_total);
+	
+	return 0;
+}
@@ -0,0 +1,72 @@
+#ifndef LOUIERIKSSON_WGCCRE_BENCH_MEASURE_HPP
+#define LOUIERIKSSON_WGCCRE_BENCH_MEASURE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+namespace LouiEriksson::Bench {
+	
+	/** @brief The shortest time over which a measurement is taken. */
+	constexpr std::chrono::milliseconds s_Duration { 20 };
+	
+	/** @brief The number of measurements taken, of which the fastest is reported. */
+	constexpr std::size_t s_Repeats = 5U;
+	
+	/** @brief Storage for Consume(), which the compiler cannot elide writes to. */
+	template<typename T>
+	inline volatile T s_Sink {};
+	
+	/**
+	 * @brief Prevents the compiler from discarding a value which is otherwise unused.
+	 */
+	template<typename T>
+	void Consume(const T& _value) {
+		s_Sink<T> = _value;
+	}
+	
+	/**
+	 * @brief Returns the mean time of one evaluation, repeating a function until s_Duration has passed.
+	 *
+	 * @details This is measured s_Repeats times and the fastest is returned, as interruptions only ever add time.
+	 *
+	 * @param[in] _f A function evaluating \p _per_call epochs each time it is invoked.
+	 * @param[in] _per_call The number of epochs evaluated per invocation.
+	 * @return The mean time per epoch (nanoseconds).
+	 */
+	template<typename F>
+	double Measure(const F& _f, const std::size_t& _per_call) {
+		
+		using Clock = std::chrono::steady_clock;
+		
+		// Once untimed, so that the first measurement does not include warming the caches.
+		_f();
+		
+		double result = std::numeric_limits<double>::infinity();
+		
+		for (std::size_t i = 0U; i < s_Repeats; ++i) {
+			
+			std::size_t calls = 0U;
+			
+			const auto begin = Clock::now();
+			
+			auto end = begin;
+			while (end - begin < s_Duration) {
+				
+				_f();
+				
+				++calls;
+				
+				end = Clock::now();
+			}
+			
+			result = std::min(result, std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(calls * _per_call));
+		}
+		
+		return result;
+	}
+
+} // LouiEriksson::Bench
+
+#endif //LOUIERIKSSON_WGCCRE_BENCH_MEASURE_HPP
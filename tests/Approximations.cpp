@@ -0,0 +1,245 @@
+/**
+ * @file Approximations.cpp
+ * @brief Checks the approximating evaluators, and the errors they report, against Reference.
+ */
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/**
+	 * @brief Returns the orientation of a body from Reference.
+	 */
+	std::array<long double, 3U> Expected(const WGCCRE::Body& _body, const long double& _t) {
+		return *Reference::GetOrientation(WGCCRE::GetName(_body), _t);
+	}
+	
+	/**
+	 * @brief Checks that every Chebyshev approximation meets its tolerance, including between the fitted nodes.
+	 */
+	void CheckChebyshev() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const double begin = 0.01, end = 0.011, tolerance = 1.0e-6;
+			
+			const auto chebyshev = WGCCRE::GetChebyshev<body>(begin, end, 1.0e-4, tolerance);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(chebyshev.Segments() > 0U);
+			LOUIERIKSSON_WGCCRE_CHECK(chebyshev.Error() <= tolerance);
+			
+			for (std::size_t i = 0U; i <= 997U; ++i) {
+				
+				const double t = begin + ((end - begin) * (static_cast<double>(i) / 997.0));
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(chebyshev.Get(t), Expected(body, t)) <= 2.0L * tolerance);
+			}
+		});
+		
+		// Parameters that cannot describe a window still produce a usable approximation of one segment.
+		const auto degenerate = WGCCRE::GetChebyshev<WGCCRE::Body::Mars>(0.01, 0.01, 0.0, 1.0e-6);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(degenerate.Segments() == 1U);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(degenerate.Get(0.01), Expected(WGCCRE::Body::Mars, 0.01L)) <= 1.0e-6L);
+	}
+	
+	/**
+	 * @brief Checks LookupTable against the errors it reports, in both methods of interpolation and in batches.
+	 */
+	void CheckLookupTable() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			// A window a century from J2000.0, sampled every hour.
+			const double centre = 0.1, radius = 1.0e-5, step = 1.0 / (24.0 * 365250.0);
+			
+			const auto table = WGCCRE::GetLookupTable<body>(centre, radius, step);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(table.Count() > 0U);
+			LOUIERIKSSON_WGCCRE_CHECK(table.Error(WGCCRE::Interpolation::Cubic) <= table.Error(WGCCRE::Interpolation::Linear) + 1.0e-9);
+			
+			std::array<double, 64U> t{}, alpha{}, delta{}, W{};
+			for (std::size_t i = 0U; i < t.size(); ++i) {
+				t[i] = (centre - radius) + ((2.0 * radius) * (static_cast<double>(i) + 0.37) / static_cast<double>(t.size()));
+			}
+			
+			table.Get(t.data(), t.size(), alpha.data(), delta.data(), W.data());
+			
+			for (std::size_t i = 0U; i < t.size(); ++i) {
+				
+				const auto expected = Expected(body, t[i]);
+				
+				// The reported errors are sampled, so allow a margin over them.
+				const long double linear = (2.0L * table.Error(WGCCRE::Interpolation::Linear)) + 1.0e-7L;
+				const long double cubic  = (2.0L * table.Error(WGCCRE::Interpolation::Cubic )) + 1.0e-7L;
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(table.template Get<WGCCRE::Interpolation::Linear>(t[i]), expected) <= linear);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(table.template Get<WGCCRE::Interpolation::Cubic >(t[i]), expected) <= cubic);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(std::array<double, 3U> { alpha[i], delta[i], W[i] }, expected) <= cubic);
+				LOUIERIKSSON_WGCCRE_CHECK(W[i] >= 0.0 && W[i] < 360.0);
+			}
+		});
+	}
+	
+	/**
+	 * @brief Checks that a Stepper tracks the direct evaluation over many steps.
+	 */
+	void CheckStepper() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			// One-minute steps.
+			const double t = 0.0123, dt = 1.0 / (1440.0 * 365250.0);
+			
+			auto stepper = WGCCRE::GetStepper<body>(t, dt, 64U);
+			
+			bool good = true;
+			for (std::size_t i = 0U; i < 1000U; ++i) {
+				
+				good = good && AngularDistance(stepper.Get(), Expected(body, stepper.Epoch())) <= 1.0e-7L;
+				
+				stepper.Step();
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+			LOUIERIKSSON_WGCCRE_CHECK(std::fabs(stepper.Epoch() - (t + (1000.0 * dt))) <= 1.0e-15);
+		});
+	}
+	
+	/**
+	 * @brief Checks that a float re-centred model stays close to Reference for a day either side of its epoch.
+	 */
+	void CheckRecentred() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const double epoch = 0.1;
+			
+			const auto recentred = WGCCRE::GetRecentred<body, float>(epoch);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(recentred.Epoch() == epoch);
+			
+			for (const auto& days : { -1.0F, -0.25F, 0.0F, 0.5F, 1.0F }) {
+				
+				const float offset = days / 365250.0F;
+				
+				const auto expected = Expected(body, static_cast<long double>(epoch) + static_cast<long double>(offset));
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(recentred.Get(offset), expected) <= 1.0e-3L);
+			}
+		});
+	}
+	
+	/**
+	 * @brief Checks the accuracy tiers against Reference, and the library's own measurement of its error.
+	 */
+	void CheckPrecision() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			for (const auto& tolerance : { 1.0e-2, 1.0e-6, 1.0e-9 }) {
+				
+				const long double t = 0.0123L;
+				
+				const auto split  = LouiEriksson::Test::Split<double>(t);
+				const auto result = WGCCRE::GetOrientationWithin<body>(split, tolerance);
+				
+				if (LOUIERIKSSON_WGCCRE_CHECK(result.has_value())) {
+					LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(*result, Expected(body, t)) <= tolerance);
+				}
+			}
+			
+			const auto error = WGCCRE::GetMaxError<body, double>(-0.1, 0.1, 101U);
+			
+			for (const auto& e : error) {
+				LOUIERIKSSON_WGCCRE_CHECK(e >= 0.0 && e <= 1.0e-7);
+			}
+			
+			const auto reference = WGCCRE::GetReferenceOrientation<body>(0.05);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(reference, Expected(body, 0.05L)) <= 1.0e-8L);
+		});
+	}
+	
+	/**
+	 * @brief Checks that the pole, matrix and quaternion describe the same orientation.
+	 */
+	void CheckRepresentations() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const double t = 0.0123;
+			
+			const auto expected = Expected(body, t);
+			
+			constexpr long double D2R = 3.14159265358979323846264338327950288L / 180.0L;
+			
+			const std::array<long double, 3U> pole {
+				std::cos(expected[1] * D2R) * std::cos(expected[0] * D2R),
+				std::cos(expected[1] * D2R) * std::sin(expected[0] * D2R),
+				std::sin(expected[1] * D2R)
+			};
+			
+			const auto actual = WGCCRE::GetPole<body>(t);
+			
+			const auto matrix     = WGCCRE::GetMatrix<body>(t);
+			const auto quaternion = WGCCRE::GetQuaternion<body>(t);
+			
+			long double pole_error = 0.0L, orthogonality = 0.0L, norm = 0.0L;
+			
+			for (std::size_t i = 0U; i < 3U; ++i) {
+				
+				pole_error = std::max(pole_error, std::fabs(actual[i] - pole[i]));
+				
+				for (std::size_t j = 0U; j < 3U; ++j) {
+					
+					long double dot = 0.0L;
+					for (std::size_t k = 0U; k < 3U; ++k) {
+						dot += static_cast<long double>(matrix[i][k]) * static_cast<long double>(matrix[j][k]);
+					}
+					
+					orthogonality = std::max(orthogonality, std::fabs(dot - (i == j ? 1.0L : 0.0L)));
+				}
+			}
+			
+			for (const auto& q : quaternion) {
+				norm += static_cast<long double>(q) * static_cast<long double>(q);
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(pole_error <= 1.0e-9L);
+			LOUIERIKSSON_WGCCRE_CHECK(orthogonality <= 1.0e-12L);
+			LOUIERIKSSON_WGCCRE_CHECK(std::fabs(norm - 1.0L) <= 1.0e-12L);
+		});
+	}
+
+} // namespace
+
+int main() {
+	
+	CheckChebyshev();
+	CheckLookupTable();
+	CheckStepper();
+	CheckRecentred();
+	CheckPrecision();
+	CheckRepresentations();
+	
+	return LouiEriksson::Test::Summarise("Approximations");
+}
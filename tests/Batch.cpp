@@ -0,0 +1,284 @@
+/**
+ * @file Batch.cpp
+ * @brief Checks the batched, vectorised and multi-body evaluators against the scalar evaluators.
+ *
+ * @details Built twice: once as-is, and once with LOUIERIKSSON_WGCCRE_NO_DISPATCH, so that both the instruction sets
+ * selected at runtime and those enabled at compile time are covered.
+ */
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <vector>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/** @brief Batch sizes either side of every vector width, and of the blocks used internally. */
+	constexpr std::array<std::size_t, 14U> s_Counts { 0U, 1U, 2U, 3U, 4U, 5U, 7U, 8U, 9U, 15U, 16U, 17U, 63U, 257U };
+	
+	/**
+	 * @brief Returns \p _count evenly-spaced epochs from \p _begin.
+	 */
+	template<typename T>
+	std::vector<T> Epochs(const T& _begin, const T& _step, const std::size_t& _count) {
+		
+		std::vector<T> result(_count);
+		
+		for (std::size_t i = 0U; i < _count; ++i) {
+			result[i] = _begin + (static_cast<T>(i) * _step);
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Checks the batched evaluators of every body against the scalar evaluators, element by element.
+	 *
+	 * @param[in] _begin The first epoch.
+	 * @param[in] _step The interval between epochs.
+	 * @param[in] _tolerance The largest acceptable difference in any component (degrees).
+	 */
+	template<typename T>
+	void CheckBatches(const T& _begin, const T& _step, const long double& _tolerance) {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto name = WGCCRE::GetName(body);
+			
+			for (const auto& count : s_Counts) {
+				
+				const auto t = Epochs(_begin, _step, count);
+				
+				std::vector<WGCCRE::SplitEpoch<T>> split(count);
+				for (std::size_t i = 0U; i < count; ++i) {
+					split[i] = LouiEriksson::Test::Split<T>(t[i]);
+				}
+				
+				std::vector<T> alpha(count), delta(count), W(count), x(count), y(count), z(count), sx(count), sy(count), sz(count);
+				std::vector<std::array<T, 3U>> out(count);
+				
+				WGCCRE::GetOrientation<body>(t.data(), count, alpha.data(), delta.data(), W.data());
+				WGCCRE::GetOrientation<body>(t.data(), count, out.data());
+				WGCCRE::GetOrientation<body>(split.data(), count, sx.data(), sy.data(), sz.data());
+				
+				WGCCRE::GetOrientationVSOP87<body>(t.data(), count, x.data(), y.data(), z.data());
+				
+				for (std::size_t i = 0U; i < count; ++i) {
+					
+					const auto expected = WGCCRE::GetOrientation<body>(t[i]);
+					
+					LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(std::array<T, 3U> { alpha[i], delta[i], W[i] }, expected) <= _tolerance);
+					LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(out[i], expected) <= _tolerance);
+					
+					LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(std::array<T, 3U> { sx[i], sy[i], sz[i] }, WGCCRE::GetOrientation<body>(split[i])) <= _tolerance);
+					
+					LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(std::array<T, 3U> { x[i], y[i], z[i] }, WGCCRE::GetOrientationVSOP87<body>(t[i])) <= _tolerance);
+				}
+				
+				// Selecting the body at runtime, or by name, must write the same values.
+				std::vector<T> rx(count), ry(count), rz(count), nx(count), ny(count), nz(count);
+				
+				WGCCRE::GetOrientationVSOP87(body, t.data(), count, rx.data(), ry.data(), rz.data());
+				
+				LOUIERIKSSON_WGCCRE_CHECK(WGCCRE::GetOrientationVSOP87(name, t.data(), count, nx.data(), ny.data(), nz.data()));
+				
+				LOUIERIKSSON_WGCCRE_CHECK(rx == x && ry == y && rz == z);
+				LOUIERIKSSON_WGCCRE_CHECK(nx == x && ny == y && nz == z);
+			}
+		});
+		
+		std::array<T, 1U> t { _begin }, x { 1 }, y { 2 }, z { 3 };
+		
+		LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::GetOrientationVSOP87("Pluto", t.data(), t.size(), x.data(), y.data(), z.data()));
+		LOUIERIKSSON_WGCCRE_CHECK(x[0] == 1 && y[0] == 2 && z[0] == 3);
+	}
+	
+	/**
+	 * @brief Checks that evaluating a subset of the components leaves the others zero and the rest unchanged.
+	 */
+	void CheckComponents() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const double t = 0.0123;
+			
+			const auto all  = WGCCRE::GetOrientation<body>(t);
+			const auto pole = WGCCRE::GetOrientation<body, WGCCRE::Components::Pole>(t);
+			const auto W    = WGCCRE::GetOrientation<body, WGCCRE::Components::W>(t);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(std::fabs(pole[0] - all[0]) <= 1.0e-12 && std::fabs(pole[1] - all[1]) <= 1.0e-12 && pole[2] == 0.0);
+			LOUIERIKSSON_WGCCRE_CHECK(W[0] == 0.0 && W[1] == 0.0 && std::fabs(W[2] - all[2]) <= 1.0e-6);
+		});
+	}
+	
+	/**
+	 * @brief Checks GetAllOrientations(), Cache and System against one another and against Reference.
+	 */
+	void CheckAllBodies() {
+		
+		WGCCRE::Cache<double, 2U> cache;
+		
+		for (const auto& t : { -0.05, 0.0, 0.0123, 0.0123, 0.1 }) {
+			
+			const auto all   = WGCCRE::GetAllOrientations(t);
+			const auto vsop  = WGCCRE::GetAllOrientationsVSOP87(t);
+			
+			const WGCCRE::System<WGCCRE::Body::Mars,    double> mars   (t);
+			const WGCCRE::System<WGCCRE::Body::Jupiter, double> jupiter(t);
+			const WGCCRE::System<WGCCRE::Body::Saturn,  double> saturn (t);
+			
+			LouiEriksson::Test::ForEachBody([&](auto _b) {
+				
+				constexpr auto body = decltype(_b)::value;
+				
+				const auto expected = WGCCRE::GetOrientation<body>(t);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(all[body], expected) <= 1.0e-9L);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(all[body], *Reference::GetOrientation(WGCCRE::GetName(body), static_cast<long double>(t))) <= 1.0e-7L);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(vsop[body], WGCCRE::GetOrientationVSOP87<body>(t)) <= 1.0e-7L);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(cache.GetOrientation(body, t), all[body]) == 0.0L);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(cache.GetOrientationVSOP87(body, t), vsop[body]) <= 1.0e-7L);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetThreadCache<double>().GetOrientation(body, t), all[body]) == 0.0L);
+				
+				for (const auto& system : { mars.GetOrientation(body), jupiter.GetOrientation(body), saturn.GetOrientation(body) }) {
+					
+					if (system.has_value()) {
+						LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(*system, all[body]) <= 1.0e-9L);
+					}
+				}
+			});
+			
+			LOUIERIKSSON_WGCCRE_CHECK(!mars.GetOrientation(WGCCRE::Body::Io).has_value());
+			LOUIERIKSSON_WGCCRE_CHECK(!saturn.GetOrientation(WGCCRE::Body::Saturn).has_value());
+		}
+		
+		cache.Invalidate();
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(cache.GetOrientation(WGCCRE::Body::Titan, 0.5), WGCCRE::GetOrientation<WGCCRE::Body::Titan>(0.5)) == 0.0L);
+	}
+	
+	/**
+	 * @brief Checks Generate(), Stream and, where available, the coroutine Generate() against Reference.
+	 */
+	void CheckRanges() {
+		
+		const std::vector<WGCCRE::Body> bodies { WGCCRE::Body::Moon, WGCCRE::Body::Mars, WGCCRE::Body::Io, WGCCRE::Body::Mars };
+		
+		const double begin = -0.02, step = 1.0e-4;
+		
+		const std::size_t count = 1000U;
+		
+		const auto check = [&](const WGCCRE::Body& _body, const std::size_t& _index, const double& _alpha, const double& _delta, const double& _W) {
+			
+			const auto expected = *Reference::GetOrientation(WGCCRE::GetName(_body), static_cast<long double>(begin + (static_cast<double>(_index) * step)));
+			
+			return AngularDistance(std::array<double, 3U> { _alpha, _delta, _W }, expected) <= 1.0e-7L;
+		};
+		
+		for (const auto& threads : { 1U, 3U, 0U }) {
+			
+			std::vector<double> out(bodies.size() * 3U * count);
+			
+			WGCCRE::Generate(bodies.data(), bodies.size(), begin, step, count, out.data(), threads);
+			
+			bool good = true;
+			for (std::size_t b = 0U; b < bodies.size(); ++b) {
+				
+				const double* values = out.data() + (b * 3U * count);
+				
+				for (std::size_t i = 0U; i < count; ++i) {
+					good = good && check(bodies[b], i, values[i], values[count + i], values[(2U * count) + i]);
+				}
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+		}
+		
+		const auto check_batch = [&](const WGCCRE::Batch<double>& _batch, std::size_t& _next) {
+			
+			bool good = _batch.offset == _next && _batch.count > 0U;
+			
+			for (const auto& body : bodies) {
+				
+				const auto& values = _batch[body];
+				
+				for (std::size_t i = 0U; i < _batch.count && good; ++i) {
+					good = check(body, _batch.offset + i, values[0U][i], values[1U][i], values[2U][i]);
+				}
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+			LOUIERIKSSON_WGCCRE_CHECK(_batch[WGCCRE::Body::Sol][0U] == nullptr);
+			
+			_next += _batch.count;
+		};
+		
+		const std::size_t size = 128U;
+		
+		WGCCRE::Stream<double> stream(bodies, begin, step, count, size);
+		
+		// The range is single-pass, but restarts from the first batch on each call to begin().
+		for (std::size_t pass = 0U; pass < 2U; ++pass) {
+			
+			std::size_t next = 0U;
+			for (const auto& batch : stream) {
+				check_batch(batch, next);
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(next == count);
+		}
+
+#if defined(LOUIERIKSSON_WGCCRE_COROUTINES)
+		
+		std::size_t next = 0U;
+		for (const auto& batch : WGCCRE::Generate(bodies, begin, step, count, size)) {
+			check_batch(batch, next);
+		}
+		
+		LOUIERIKSSON_WGCCRE_CHECK(next == count);
+#endif
+	}
+	
+	/**
+	 * @brief Returns the name of an instruction set, for the log.
+	 */
+	const char* GetName(const WGCCRE::InstructionSet& _set) {
+		
+		switch (_set) {
+			case WGCCRE::InstructionSet::Scalar: { return "Scalar"; }
+			case WGCCRE::InstructionSet::SSE2:   { return "SSE2";   }
+			case WGCCRE::InstructionSet::AVX:    { return "AVX";    }
+			case WGCCRE::InstructionSet::NEON:   { return "NEON";   }
+			case WGCCRE::InstructionSet::AVX2:   { return "AVX2";   }
+			case WGCCRE::InstructionSet::AVX512: { return "AVX512"; }
+			default: {
+				return "Unknown";
+			}
+		}
+	}
+
+} // namespace
+
+int main() {
+	
+	std::printf("Instruction set: %s\n", GetName(WGCCRE::GetInstructionSet()));
+	
+	CheckBatches<float>      (-2.0e-4F, 1.0e-6F, 1.0e-3L);
+	CheckBatches<double>     (-0.1,     7.3e-4,  1.0e-8L);
+	CheckBatches<long double>(-0.1L,    7.3e-4L, 1.0e-12L);
+	
+	CheckComponents();
+	CheckAllBodies();
+	CheckRanges();
+	
+	return LouiEriksson::Test::Summarise("Batch");
+}
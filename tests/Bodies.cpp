@@ -0,0 +1,143 @@
+/**
+ * @file Bodies.cpp
+ * @brief Checks every body, in every precision and by every means of selecting it, against Reference.
+ */
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <initializer_list>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/** @brief Epochs spanning a century either side of J2000.0, in Julian millennia. */
+	constexpr std::initializer_list<long double> s_Epochs { -0.1L, -0.025L, 0.0L, 0.0123L, 0.05L, 0.1L };
+	
+	/** @brief Epochs within a few months of J2000.0, where float keeps W to a useful precision. */
+	constexpr std::initializer_list<long double> s_NearEpochs { -2.0e-4L, -1.0e-5L, 0.0L, 1.0e-5L, 3.0e-4L };
+	
+	/**
+	 * @brief Checks the scalar, split and VSOP87 evaluators of every body in \p T against Reference.
+	 *
+	 * @param[in] _epochs The epochs to check.
+	 * @param[in] _tolerance The largest acceptable error in any component (degrees).
+	 */
+	template<typename T>
+	void CheckBodies(const std::initializer_list<long double>& _epochs, const long double& _tolerance) {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto name = WGCCRE::GetName(body);
+			
+			for (const auto& t : _epochs) {
+				
+				const auto expected = Reference::GetOrientation(name, t);
+				
+				if (!LOUIERIKSSON_WGCCRE_CHECK(expected.has_value())) {
+					continue;
+				}
+				
+				const auto vsop87 = Reference::ToVSOP87(*expected);
+				
+				const auto epoch = static_cast<T>(t);
+				const auto split = LouiEriksson::Test::Split<T>(t);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientation<body>(epoch), *expected) <= _tolerance);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientation<body>(split), *expected) <= _tolerance);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientationVSOP87<body>(epoch),    vsop87) <= _tolerance);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientationVSOP87(body, epoch),    vsop87) <= _tolerance);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientationVSOP87(body, split),    vsop87) <= _tolerance);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientationVSOP87(name, epoch),    vsop87) <= _tolerance);
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(*WGCCRE::TryGetOrientationVSOP87(name, epoch), vsop87) <= _tolerance);
+				
+				const auto state = WGCCRE::GetState<body>(epoch);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(state.value, *expected) <= _tolerance);
+			}
+		});
+	}
+	
+	/**
+	 * @brief Checks the analytic rates of every body against central differences of Reference.
+	 */
+	void CheckRates() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto name = WGCCRE::GetName(body);
+			
+			// One minute, in Julian millennia.
+			constexpr long double h = 1.0L / (1440.0L * 365250.0L);
+			
+			for (const auto& t : s_Epochs) {
+				
+				const auto before = *Reference::GetOrientation(name, t - h);
+				const auto after  = *Reference::GetOrientation(name, t + h);
+				
+				const auto state = WGCCRE::GetState<body>(static_cast<double>(t));
+				
+				for (std::size_t i = 0U; i < 3U; ++i) {
+					
+					const long double expected = (after[i] - before[i]) / (2.0L * h);
+					
+					// Relative to the rate, which for W is of the order of 1e8 degrees per millennium.
+					LOUIERIKSSON_WGCCRE_CHECK(std::fabs(state.rate[i] - expected) <= 1.0e-6L * std::max(1.0L, std::fabs(expected)));
+				}
+			}
+		});
+	}
+	
+	/**
+	 * @brief Checks that names and bodies convert to one another, and that unknown names are reported.
+	 */
+	void CheckNames() {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			const auto resolved = WGCCRE::GetBody(WGCCRE::GetName(body));
+			
+			LOUIERIKSSON_WGCCRE_CHECK(resolved.has_value() && *resolved == body);
+		});
+		
+		LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::GetBody("Pluto").has_value());
+		LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::TryGetOrientationVSOP87("Pluto", 0.0).has_value());
+		LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::TryGetOrientationVSOP87("", 0.0).has_value());
+	}
+	
+	/**
+	 * @brief Checks that the evaluators are usable in constant expressions.
+	 */
+	void CheckConstexpr() {
+		
+		constexpr auto mars = WGCCRE::GetOrientation<WGCCRE::Body::Mars>(0.0123);
+		constexpr auto all  = WGCCRE::GetAllOrientations(0.0123);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(mars, all[WGCCRE::Body::Mars]) == 0.0L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(mars, *Reference::GetOrientation("Mars", 0.0123L)) <= 1.0e-7L);
+	}
+
+} // namespace
+
+int main() {
+	
+	CheckBodies<float>      (s_NearEpochs, 5.0e-2L);
+	CheckBodies<double>     (s_Epochs,     1.0e-7L);
+	CheckBodies<long double>(s_Epochs,     1.0e-8L);
+	
+	CheckRates();
+	CheckNames();
+	CheckConstexpr();
+	
+	return LouiEriksson::Test::Summarise("Bodies");
+}
@@ -0,0 +1,142 @@
+/**
+ * @file OpenCL.cpp
+ * @brief Checks the OpenCL kernel against Reference on the first available device, skipping if there is none.
+ */
+
+#if !defined(CL_TARGET_OPENCL_VERSION)
+#define CL_TARGET_OPENCL_VERSION 120
+#endif
+
+#if !defined(LOUIERIKSSON_WGCCRE_OPENCL)
+#define LOUIERIKSSON_WGCCRE_OPENCL
+#endif
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/** @brief The exit code reported to CTest when there is no device to test on. */
+	constexpr int s_Skipped = 77;
+	
+	/**
+	 * @brief Evaluates every body on a device in \p T and checks the results against Reference.
+	 *
+	 * @param[in] _context The context of the device.
+	 * @param[in] _device The device.
+	 * @param[in] _queue A command queue on the device.
+	 * @param[in] _begin The first epoch.
+	 * @param[in] _step The interval between epochs.
+	 * @param[in] _tolerance The largest acceptable error in any component (degrees).
+	 */
+	template<typename T>
+	void CheckDevice(const cl_context& _context, const cl_device_id& _device, const cl_command_queue& _queue, const T& _begin, const T& _step, const long double& _tolerance) {
+		
+		WGCCRE::Device<T> device(_context, _device, _queue);
+		
+		if (!LOUIERIKSSON_WGCCRE_CHECK(device.Status() == CL_SUCCESS)) {
+			return;
+		}
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			// Enough epochs to fill several work groups, and not a multiple of any of their sizes.
+			const std::size_t count = 1000U;
+			
+			std::vector<T> t(count), alpha(count), delta(count), W(count);
+			for (std::size_t i = 0U; i < count; ++i) {
+				t[i] = _begin + (static_cast<T>(i) * _step);
+			}
+			
+			if (!LOUIERIKSSON_WGCCRE_CHECK(device.template Evaluate<body>(t.data(), count, alpha.data(), delta.data(), W.data()) == CL_SUCCESS)) {
+				return;
+			}
+			
+			bool good = true;
+			for (std::size_t i = 0U; i < count; ++i) {
+				
+				const auto expected = *Reference::GetOrientation(WGCCRE::GetName(body), static_cast<long double>(t[i]));
+				
+				good = good && AngularDistance(std::array<T, 3U> { alpha[i], delta[i], W[i] }, expected) <= _tolerance;
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+			
+			// An empty range dispatches nothing and succeeds.
+			LOUIERIKSSON_WGCCRE_CHECK(device.template Evaluate<body>(t.data(), 0U, alpha.data(), delta.data(), W.data()) == CL_SUCCESS);
+		});
+	}
+	
+	/**
+	 * @brief Returns whether a device supports double precision.
+	 */
+	bool SupportsDouble(const cl_device_id& _device) {
+		
+		std::size_t size = 0U;
+		
+		if (clGetDeviceInfo(_device, CL_DEVICE_EXTENSIONS, 0U, nullptr, &size) != CL_SUCCESS) {
+			return false;
+		}
+		
+		std::string extensions(size, '\0');
+		
+		if (clGetDeviceInfo(_device, CL_DEVICE_EXTENSIONS, size, extensions.data(), nullptr) != CL_SUCCESS) {
+			return false;
+		}
+		
+		return extensions.find("cl_khr_fp64") != std::string::npos;
+	}
+
+} // namespace
+
+int main() {
+	
+	cl_platform_id platform = nullptr;
+	cl_device_id   device   = nullptr;
+	
+	cl_uint platforms = 0U, devices = 0U;
+	
+	if (clGetPlatformIDs(1U, &platform, &platforms) != CL_SUCCESS || platforms == 0U ||
+	    clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1U, &device, &devices) != CL_SUCCESS || devices == 0U) {
+		
+		std::printf("OpenCL: skipped, no device is available\n");
+		
+		return s_Skipped;
+	}
+	
+	cl_int status = CL_SUCCESS;
+	
+	const cl_context context = clCreateContext(nullptr, 1U, &device, nullptr, nullptr, &status);
+	
+	if (!LOUIERIKSSON_WGCCRE_CHECK(status == CL_SUCCESS)) {
+		return LouiEriksson::Test::Summarise("OpenCL");
+	}
+	
+	const cl_command_queue queue = clCreateCommandQueue(context, device, 0U, &status);
+	
+	if (LOUIERIKSSON_WGCCRE_CHECK(status == CL_SUCCESS)) {
+		
+		// Devices evaluate the sines in their own precision, so float is held to the tolerance of the near epochs only.
+		CheckDevice<float>(context, device, queue, -2.0e-4F, 5.0e-7F, 5.0e-2L);
+		
+		if (SupportsDouble(device)) {
+			CheckDevice<double>(context, device, queue, -0.1, 2.0e-4, 1.0e-7L);
+		}
+		
+		clReleaseCommandQueue(queue);
+	}
+	
+	clReleaseContext(context);
+	
+	return LouiEriksson::Test::Summarise("OpenCL");
+}
@@ -0,0 +1,201 @@
+/**
+ * @file Policy.cpp
+ * @brief Checks that report policies select the intended models, through every entry point of Registry.
+ */
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/** @brief Mars from the 2009 report, everything else as by default. */
+	using Reports2009Mars = WGCCRE::Reports<WGCCRE::Pin<WGCCRE::Body::Mars, WGCCRE::Report_2009>, WGCCRE::DefaultReports>;
+	
+	/** @brief The 2009 report wherever it defines a body. */
+	using Reports2009 = WGCCRE::Reports<WGCCRE::Report_2009, WGCCRE::Report_2015>;
+	
+	using Registry = WGCCRE::Registry<Reports2009Mars>;
+	
+	static_assert( WGCCRE::Report_2009::Provides<WGCCRE::Body::Mars>());
+	static_assert(!WGCCRE::Report_2009::Provides<WGCCRE::Body::Sol>());
+	static_assert(!WGCCRE::Pin<WGCCRE::Body::Mars, WGCCRE::Report_2009>::Provides<WGCCRE::Body::Jupiter>());
+	static_assert( Reports2009Mars::Provides<WGCCRE::Body::Jupiter>());
+	
+	/**
+	 * @brief Returns the orientation of Mars, as given by the 2009 report.
+	 */
+	std::array<long double, 3U> Expected(const long double& _t) {
+		return Reference::Report_2009::Mars(_t);
+	}
+	
+	/**
+	 * @brief Checks that a policy selects models in the order its reports are listed.
+	 */
+	void CheckSelection() {
+		
+		const long double t = 0.0123L;
+		
+		// The two reports' models of Mars differ by far more than either's error, so each can be told apart.
+		const auto report_2009 = Reference::Report_2009::Mars(t);
+		const auto report_2015 = Reference::Report_2015::Mars(t);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(report_2009, report_2015) > 1.0e-4L);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::GetOrientation<WGCCRE::Body::Mars>(static_cast<double>(t)), report_2015) <= 1.0e-7L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetOrientation<WGCCRE::Body::Mars>(static_cast<double>(t)), report_2009) <= 1.0e-7L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::Registry<Reports2009>::GetOrientation<WGCCRE::Body::Mars>(static_cast<double>(t)), report_2009) <= 1.0e-7L);
+		
+		// Bodies that are not pinned fall through to the rest of the list.
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			if constexpr (body != WGCCRE::Body::Mars) {
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetOrientation<body>(0.0123), WGCCRE::GetOrientation<body>(0.0123)) == 0.0L);
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK((&WGCCRE::Registry<WGCCRE::DefaultReports>::GetModel<body, double>() == &WGCCRE::DefaultReports::GetModel<body, double>()));
+		});
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(WGCCRE::Registry<Reports2009>::GetOrientation<WGCCRE::Body::Sol>(static_cast<double>(t)), Reference::Report_2015::Sol(t)) <= 1.0e-7L);
+	}
+	
+	/**
+	 * @brief Checks that every entry point of Registry evaluates the model of Mars the policy selects.
+	 */
+	void CheckEntryPoints() {
+		
+		constexpr auto mars = WGCCRE::Body::Mars;
+		
+		const double t = 0.0123;
+		
+		const auto expected = Expected(t);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetOrientation<mars>(LouiEriksson::Test::Split<double>(t)), expected) <= 1.0e-7L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetOrientationVSOP87<mars>(t), Reference::ToVSOP87(expected)) <= 1.0e-7L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetState<mars>(t).value, expected) <= 1.0e-7L);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetAllOrientations(t)[mars], expected) <= 1.0e-7L);
+		LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetAllOrientationsVSOP87(t)[mars], Reference::ToVSOP87(expected)) <= 1.0e-7L);
+		
+		{
+			std::array<double, 17U> epochs{}, alpha{}, delta{}, W{};
+			for (std::size_t i = 0U; i < epochs.size(); ++i) {
+				epochs[i] = t + (static_cast<double>(i) * 1.0e-4);
+			}
+			
+			Registry::GetOrientation<mars>(epochs.data(), epochs.size(), alpha.data(), delta.data(), W.data());
+			
+			bool good = true;
+			for (std::size_t i = 0U; i < epochs.size(); ++i) {
+				good = good && AngularDistance(std::array<double, 3U> { alpha[i], delta[i], W[i] }, Expected(epochs[i])) <= 1.0e-7L;
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+		}
+		
+		{
+			Registry::Cache<double> cache;
+			
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(cache.GetOrientation(mars, t), expected) <= 1.0e-7L);
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(Registry::GetThreadCache<double>().GetOrientation(mars, t), expected) <= 1.0e-7L);
+		}
+		
+		{
+			const Registry::System<mars, double> system(t);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(system.GetOrientation<WGCCRE::Body::Phobos>(), Reference::Report_2009::Phobos(static_cast<long double>(t))) <= 1.0e-7L);
+		}
+		
+		{
+			const std::vector<WGCCRE::Body> bodies { mars };
+			
+			const std::size_t count = 100U;
+			
+			std::vector<double> out(3U * count);
+			
+			Registry::Generate(bodies.data(), bodies.size(), t, 1.0e-4, count, out.data(), 2U);
+			
+			bool good = true;
+			for (std::size_t i = 0U; i < count; ++i) {
+				good = good && AngularDistance(std::array<double, 3U> { out[i], out[count + i], out[(2U * count) + i] }, Expected(t + (static_cast<double>(i) * 1.0e-4))) <= 1.0e-7L;
+			}
+			
+			for (const auto& batch : Registry::Stream<double>(bodies, t, 1.0e-4, count, 32U)) {
+				
+				const auto& values = batch[mars];
+				
+				for (std::size_t i = 0U; i < batch.count; ++i) {
+					good = good && AngularDistance(std::array<double, 3U> { values[0U][i], values[1U][i], values[2U][i] }, Expected(t + (static_cast<double>(batch.offset + i) * 1.0e-4))) <= 1.0e-7L;
+				}
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(good);
+		}
+		
+		{
+			// One-minute steps.
+			auto stepper = Registry::GetStepper<mars>(t, 1.0 / (1440.0 * 365250.0));
+			
+			for (std::size_t i = 0U; i < 100U; ++i) {
+				stepper.Step();
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(stepper.Get(), Expected(stepper.Epoch())) <= 1.0e-7L);
+		}
+		
+		{
+			const auto chebyshev = Registry::GetChebyshev<mars>(t, t + 1.0e-3, 1.0e-4, 1.0e-6);
+			const auto table     = Registry::GetLookupTable<mars>(t, 1.0e-5, 1.0 / (24.0 * 365250.0));
+			const auto recentred = Registry::GetRecentred<mars>(t);
+			
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(chebyshev.Get(t + 3.7e-4), Expected(t + 3.7e-4)) <= 2.0e-6L);
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(table.Get<WGCCRE::Interpolation::Cubic>(t + 3.7e-6), Expected(t + 3.7e-6)) <= 1.0e-6L);
+			LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(recentred.Get(0.0F), expected) <= 1.0e-3L);
+		}
+		
+		{
+			const auto path = "Policy.tbl";
+			
+			const double step = 1.0 / (144.0 * 365250.0);
+			
+			{
+				Registry::TableWriter<double> writer(path, mars, t, step);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Append(10U));
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Close());
+			}
+			
+			const Registry::TableReader<double> reader(path);
+			
+			if (LOUIERIKSSON_WGCCRE_CHECK(reader.Good() && reader.Count() == 10U)) {
+				LOUIERIKSSON_WGCCRE_CHECK(AngularDistance(reader.At(9U), Expected(static_cast<long double>(t) + (9.0L * static_cast<long double>(step)))) <= 1.0e-7L);
+			}
+			
+			std::remove(path);
+		}
+		
+		// The packed model is laid out from the selected model.
+		const auto& model  = Registry::GetModel<mars, double>();
+		const auto  packed = Registry::GetPackedModel<mars, double>();
+		
+		LOUIERIKSSON_WGCCRE_CHECK(packed.size() == 9U + (3U * model.arguments.size()) + (4U * model.terms.size()));
+		LOUIERIKSSON_WGCCRE_CHECK(packed[0U] == model.base[0U].c0 && packed[1U] == model.base[0U].Rate());
+	}
+
+} // namespace
+
+int main() {
+	
+	CheckSelection();
+	CheckEntryPoints();
+	
+	return LouiEriksson::Test::Summarise("Policy");
+}
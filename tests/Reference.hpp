@@ -0,0 +1,507 @@
+#ifndef LOUIERIKSSON_WGCCRE_TESTS_REFERENCE_HPP
+#define LOUIERIKSSON_WGCCRE_TESTS_REFERENCE_HPP
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <string_view>
+
+namespace LouiEriksson::Test {
+	
+	/**
+	 * @brief A plain transcription of the published WGCCRE formulas, kept independent of the tables in WGCCRE.hpp.
+	 *
+	 * @details Every body is written out term by term as printed in the reports and evaluated with std::sin and
+	 * std::cos, so that a mistake in a table, in the assignment of a term to a component or argument, or in any of the
+	 * fast evaluators shows up as a disagreement. Nothing here is shared with the library.
+	 *
+	 * The epoch is in Julian millennia since J2000.0, as everywhere in WGCCRE, and is used directly as T, with
+	 * d = 365250 * T days.
+	 *
+	 * @see <a href="https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2015reprint.pdf">WGCCRE2015</a>
+	 * @see <a href="https://astropedia.astrogeology.usgs.gov/download/Docs/WGCCRE/WGCCRE2009reprint.pdf">WGCCRE2009</a>
+	 */
+	struct Reference final {
+	
+	private:
+		
+		template<typename T>
+		static T sin_d(const T& _x) {
+			return std::sin(std::fmod(_x, static_cast<T>(360.0)) * (static_cast<T>(3.14159265358979323846264338327950288L) / static_cast<T>(180.0)));
+		}
+		
+		template<typename T>
+		static T cos_d(const T& _x) {
+			return std::cos(std::fmod(_x, static_cast<T>(360.0)) * (static_cast<T>(3.14159265358979323846264338327950288L) / static_cast<T>(180.0)));
+		}
+	
+	public:
+		
+		/**
+		 * @brief Provides the bodies taken from the 2015 report.
+		 */
+		struct Report_2015 final {
+			
+			template<typename T>
+			static std::array<T, 3U> Sol(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(286.13),
+					static_cast<T>( 63.87),
+					static_cast<T>( 84.176) + (static_cast<T>(14.1844000) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Mercury(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T M1 = static_cast<T>(174.7910857) + (static_cast<T>( 4.092335) * d),
+				        M2 = static_cast<T>(349.5821714) + (static_cast<T>( 8.184670) * d),
+				        M3 = static_cast<T>(164.3732571) + (static_cast<T>(12.277005) * d),
+				        M4 = static_cast<T>(339.1643429) + (static_cast<T>(16.369340) * d),
+				        M5 = static_cast<T>(153.9554286) + (static_cast<T>(20.461675) * d);
+				
+				return {
+					static_cast<T>(281.0103) - (static_cast<T>(0.0328) * _t),
+					static_cast<T>( 61.4155) - (static_cast<T>(0.0049) * _t),
+					static_cast<T>(329.5988) + (static_cast<T>(6.1385108) * d)
+						+ (static_cast<T>(0.01067257) * sin_d(M1))
+						- (static_cast<T>(0.00112309) * sin_d(M2))
+						- (static_cast<T>(0.00011040) * sin_d(M3))
+						- (static_cast<T>(0.00002539) * sin_d(M4))
+						- (static_cast<T>(0.00000571) * sin_d(M5))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Venus(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(272.76),
+					static_cast<T>( 67.16),
+					static_cast<T>(160.20) - (static_cast<T>(1.4813688) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Mars(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(317.269202) - (static_cast<T>(0.10927547) * _t)
+						+ (static_cast<T>(0.000068) * sin_d(static_cast<T>(198.991226) + (static_cast<T>(19139.4819985) * _t)))
+						+ (static_cast<T>(0.000238) * sin_d(static_cast<T>(226.292679) + (static_cast<T>(38280.8511281) * _t)))
+						+ (static_cast<T>(0.000052) * sin_d(static_cast<T>(249.663391) + (static_cast<T>(57420.7251593) * _t)))
+						+ (static_cast<T>(0.000009) * sin_d(static_cast<T>(266.183510) + (static_cast<T>(76560.6367950) * _t)))
+						+ (static_cast<T>(0.419057) * sin_d(static_cast<T>( 79.398797) + (static_cast<T>(    0.5042615) * _t))),
+					static_cast<T>(54.432516) - (static_cast<T>(0.05827105) * _t)
+						+ (static_cast<T>(0.000051) * cos_d(static_cast<T>(122.433576) + (static_cast<T>(19139.9407476) * _t)))
+						+ (static_cast<T>(0.000141) * cos_d(static_cast<T>( 43.058401) + (static_cast<T>(38280.8753272) * _t)))
+						+ (static_cast<T>(0.000031) * cos_d(static_cast<T>( 57.663379) + (static_cast<T>(57420.7517205) * _t)))
+						+ (static_cast<T>(0.000005) * cos_d(static_cast<T>( 79.476401) + (static_cast<T>(76560.6495004) * _t)))
+						+ (static_cast<T>(1.591274) * cos_d(static_cast<T>(166.325722) + (static_cast<T>(    0.5042615) * _t))),
+					static_cast<T>(176.049863) + (static_cast<T>(350.891982443297) * d)
+						+ (static_cast<T>(0.000145) * sin_d(static_cast<T>(129.071773) + (static_cast<T>(19140.0328244) * _t)))
+						+ (static_cast<T>(0.000157) * sin_d(static_cast<T>( 36.352167) + (static_cast<T>(38281.0473591) * _t)))
+						+ (static_cast<T>(0.000040) * sin_d(static_cast<T>( 56.668646) + (static_cast<T>(57420.9295360) * _t)))
+						+ (static_cast<T>(0.000001) * sin_d(static_cast<T>( 67.364003) + (static_cast<T>(76560.2552215) * _t)))
+						+ (static_cast<T>(0.000001) * sin_d(static_cast<T>(104.792680) + (static_cast<T>(95700.4387578) * _t)))
+						+ (static_cast<T>(0.584542) * sin_d(static_cast<T>( 95.391654) + (static_cast<T>(    0.5042615) * _t)))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Jupiter(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T Ja = static_cast<T>( 99.360714) + (static_cast<T>(4850.4046) * _t),
+				        Jb = static_cast<T>(175.895369) + (static_cast<T>(1191.9605) * _t),
+				        Jc = static_cast<T>(300.323162) + (static_cast<T>( 262.5475) * _t),
+				        Jd = static_cast<T>(114.012305) + (static_cast<T>(6070.2476) * _t),
+				        Je = static_cast<T>( 49.511251) + (static_cast<T>(  64.3000) * _t);
+				
+				return {
+					static_cast<T>(268.056595) - (static_cast<T>(0.006499) * _t)
+						+ (static_cast<T>(0.000117) * sin_d(Ja)) + (static_cast<T>(0.000938) * sin_d(Jb))
+						+ (static_cast<T>(0.001432) * sin_d(Jc)) + (static_cast<T>(0.000030) * sin_d(Jd))
+						+ (static_cast<T>(0.002150) * sin_d(Je)),
+					static_cast<T>(64.495303) + (static_cast<T>(0.002413) * _t)
+						+ (static_cast<T>(0.000050) * cos_d(Ja)) + (static_cast<T>(0.000404) * cos_d(Jb))
+						+ (static_cast<T>(0.000617) * cos_d(Jc)) - (static_cast<T>(0.000013) * cos_d(Jd))
+						+ (static_cast<T>(0.000926) * cos_d(Je)),
+					static_cast<T>(284.95) + (static_cast<T>(870.5360000) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Saturn(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(40.589) - (static_cast<T>(0.036) * _t),
+					static_cast<T>(83.537) - (static_cast<T>(0.004) * _t),
+					static_cast<T>(38.90) + (static_cast<T>(810.7939024) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Uranus(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(257.311),
+					static_cast<T>(-15.175),
+					static_cast<T>(203.81) - (static_cast<T>(501.1600928) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Neptune(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T N = static_cast<T>(357.85) + (static_cast<T>(52.316) * _t);
+				
+				return {
+					static_cast<T>(299.36) + (static_cast<T>(0.70) * sin_d(N)),
+					static_cast<T>( 43.46) - (static_cast<T>(0.51) * cos_d(N)),
+					static_cast<T>(249.978) + (static_cast<T>(541.1397757) * d) - (static_cast<T>(0.48) * sin_d(N))
+				};
+			}
+		};
+		
+		/**
+		 * @brief Provides the bodies taken from the 2009 report.
+		 */
+		struct Report_2009 final {
+			
+			template<typename T>
+			static std::array<T, 3U> Earth(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>( 0.00) - (static_cast<T>(0.641) * _t),
+					static_cast<T>(90.00) - (static_cast<T>(0.557) * _t),
+					static_cast<T>(190.147) + (static_cast<T>(360.9856235) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Moon(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T E1  = static_cast<T>(125.045) - (static_cast<T>( 0.0529921) * d),
+				        E2  = static_cast<T>(250.089) - (static_cast<T>( 0.1059842) * d),
+				        E3  = static_cast<T>(260.008) + (static_cast<T>(13.0120009) * d),
+				        E4  = static_cast<T>(176.625) + (static_cast<T>(13.3407154) * d),
+				        E5  = static_cast<T>(357.529) + (static_cast<T>( 0.9856003) * d),
+				        E6  = static_cast<T>(311.589) + (static_cast<T>(26.4057084) * d),
+				        E7  = static_cast<T>(134.963) + (static_cast<T>(13.0649930) * d),
+				        E8  = static_cast<T>(276.617) + (static_cast<T>( 0.3287146) * d),
+				        E9  = static_cast<T>( 34.226) + (static_cast<T>( 1.7484877) * d),
+				        E10 = static_cast<T>( 15.134) - (static_cast<T>( 0.1589763) * d),
+				        E11 = static_cast<T>(119.743) + (static_cast<T>( 0.0036096) * d),
+				        E12 = static_cast<T>(239.961) + (static_cast<T>( 0.1643573) * d),
+				        E13 = static_cast<T>( 25.053) + (static_cast<T>(12.9590088) * d);
+				
+				return {
+					static_cast<T>(269.9949) + (static_cast<T>(0.0031) * _t)
+						- (static_cast<T>(3.8787) * sin_d(E1 )) - (static_cast<T>(0.1204) * sin_d(E2 ))
+						+ (static_cast<T>(0.0700) * sin_d(E3 )) - (static_cast<T>(0.0172) * sin_d(E4 ))
+						+ (static_cast<T>(0.0072) * sin_d(E6 )) - (static_cast<T>(0.0052) * sin_d(E10))
+						+ (static_cast<T>(0.0043) * sin_d(E13)),
+					static_cast<T>(66.5392) + (static_cast<T>(0.0130) * _t)
+						+ (static_cast<T>(1.5419) * cos_d(E1 )) + (static_cast<T>(0.0239) * cos_d(E2 ))
+						- (static_cast<T>(0.0278) * cos_d(E3 )) + (static_cast<T>(0.0068) * cos_d(E4 ))
+						- (static_cast<T>(0.0029) * cos_d(E6 )) + (static_cast<T>(0.0009) * cos_d(E7 ))
+						+ (static_cast<T>(0.0008) * cos_d(E10)) - (static_cast<T>(0.0009) * cos_d(E13)),
+					static_cast<T>(38.3213) + (static_cast<T>(13.17635815) * d) - (static_cast<T>(1.4e-12) * (d * d))
+						+ (static_cast<T>(3.5610) * sin_d(E1 )) + (static_cast<T>(0.1208) * sin_d(E2 ))
+						- (static_cast<T>(0.0642) * sin_d(E3 )) + (static_cast<T>(0.0158) * sin_d(E4 ))
+						+ (static_cast<T>(0.0252) * sin_d(E5 )) - (static_cast<T>(0.0066) * sin_d(E6 ))
+						- (static_cast<T>(0.0047) * sin_d(E7 )) - (static_cast<T>(0.0046) * sin_d(E8 ))
+						+ (static_cast<T>(0.0028) * sin_d(E9 )) + (static_cast<T>(0.0052) * sin_d(E10))
+						+ (static_cast<T>(0.0040) * sin_d(E11)) + (static_cast<T>(0.0019) * sin_d(E12))
+						- (static_cast<T>(0.0044) * sin_d(E13))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Mars(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(317.68143) - (static_cast<T>(0.1061) * _t),
+					static_cast<T>( 52.88650) - (static_cast<T>(0.0609) * _t),
+					static_cast<T>(176.630) + (static_cast<T>(350.89198226) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Phobos(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T M1 = static_cast<T>(169.51) - (static_cast<T>(   0.4357640) * d),
+				        M2 = static_cast<T>(192.93) + (static_cast<T>(1128.4096700) * d) + (static_cast<T>(8.864) * (_t * _t));
+				
+				return {
+					static_cast<T>(317.68) - (static_cast<T>(0.108) * _t) + (static_cast<T>(1.79) * sin_d(M1)),
+					static_cast<T>( 52.90) - (static_cast<T>(0.061) * _t) - (static_cast<T>(1.08) * cos_d(M1)),
+					static_cast<T>( 35.06) + (static_cast<T>(1128.8445850) * d) + (static_cast<T>(8.864) * (_t * _t))
+						- (static_cast<T>(1.42) * sin_d(M1)) - (static_cast<T>(0.78) * sin_d(M2))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Deimos(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T M3 = static_cast<T>(53.47) - (static_cast<T>(0.0181510) * d);
+				
+				return {
+					static_cast<T>(316.65) - (static_cast<T>(0.108) * _t) + (static_cast<T>(2.98) * sin_d(M3)),
+					static_cast<T>( 53.52) - (static_cast<T>(0.061) * _t) - (static_cast<T>(1.78) * cos_d(M3)),
+					static_cast<T>( 79.41) + (static_cast<T>(285.1618970) * d) - (static_cast<T>(0.520) * (_t * _t))
+						- (static_cast<T>(2.58) * sin_d(M3)) + (static_cast<T>(0.19) * cos_d(M3))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Io(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T J3 = static_cast<T>(283.90) + (static_cast<T>(4850.7) * _t),
+				        J4 = static_cast<T>(355.80) + (static_cast<T>(1191.3) * _t);
+				
+				return {
+					static_cast<T>(268.05) - (static_cast<T>(0.009) * _t) + (static_cast<T>(0.094) * sin_d(J3)) + (static_cast<T>(0.024) * sin_d(J4)),
+					static_cast<T>( 64.50) + (static_cast<T>(0.003) * _t) + (static_cast<T>(0.040) * cos_d(J3)) + (static_cast<T>(0.011) * cos_d(J4)),
+					static_cast<T>(200.39) + (static_cast<T>(203.4889538) * d) - (static_cast<T>(0.085) * sin_d(J3)) - (static_cast<T>(0.022) * sin_d(J4))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Europa(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T J4 = static_cast<T>(355.80) + (static_cast<T>(1191.3) * _t),
+				        J5 = static_cast<T>(119.90) + (static_cast<T>( 262.1) * _t),
+				        J6 = static_cast<T>(229.80) + (static_cast<T>(  64.3) * _t),
+				        J7 = static_cast<T>(352.25) + (static_cast<T>(2382.6) * _t);
+				
+				return {
+					static_cast<T>(268.08) - (static_cast<T>(0.009) * _t)
+						+ (static_cast<T>(1.086) * sin_d(J4)) + (static_cast<T>(0.060) * sin_d(J5))
+						+ (static_cast<T>(0.015) * sin_d(J6)) + (static_cast<T>(0.009) * sin_d(J7)),
+					static_cast<T>(64.51) + (static_cast<T>(0.003) * _t)
+						+ (static_cast<T>(0.468) * cos_d(J4)) + (static_cast<T>(0.026) * cos_d(J5))
+						+ (static_cast<T>(0.007) * cos_d(J6)) + (static_cast<T>(0.002) * cos_d(J7)),
+					static_cast<T>(36.022) + (static_cast<T>(101.3747235) * d)
+						- (static_cast<T>(0.980) * sin_d(J4)) - (static_cast<T>(0.054) * sin_d(J5))
+						- (static_cast<T>(0.014) * sin_d(J6)) - (static_cast<T>(0.008) * sin_d(J7))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Ganymede(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T J4 = static_cast<T>(355.80) + (static_cast<T>(1191.3) * _t),
+				        J5 = static_cast<T>(119.90) + (static_cast<T>( 262.1) * _t),
+				        J6 = static_cast<T>(229.80) + (static_cast<T>(  64.3) * _t);
+				
+				return {
+					static_cast<T>(268.20) - (static_cast<T>(0.009) * _t)
+						- (static_cast<T>(0.037) * sin_d(J4)) + (static_cast<T>(0.431) * sin_d(J5)) + (static_cast<T>(0.091) * sin_d(J6)),
+					static_cast<T>(64.57) + (static_cast<T>(0.003) * _t)
+						- (static_cast<T>(0.016) * cos_d(J4)) + (static_cast<T>(0.186) * cos_d(J5)) + (static_cast<T>(0.039) * cos_d(J6)),
+					static_cast<T>(44.064) + (static_cast<T>(50.3176081) * d)
+						+ (static_cast<T>(0.033) * sin_d(J4)) - (static_cast<T>(0.389) * sin_d(J5)) - (static_cast<T>(0.082) * sin_d(J6))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Callisto(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T J5 = static_cast<T>(119.90) + (static_cast<T>( 262.1) * _t),
+				        J6 = static_cast<T>(229.80) + (static_cast<T>(  64.3) * _t),
+				        J8 = static_cast<T>(113.35) + (static_cast<T>(6070.0) * _t);
+				
+				return {
+					static_cast<T>(268.72) - (static_cast<T>(0.009) * _t)
+						- (static_cast<T>(0.068) * sin_d(J5)) + (static_cast<T>(0.590) * sin_d(J6)) + (static_cast<T>(0.010) * sin_d(J8)),
+					static_cast<T>(64.83) + (static_cast<T>(0.003) * _t)
+						- (static_cast<T>(0.029) * cos_d(J5)) + (static_cast<T>(0.254) * cos_d(J6)) - (static_cast<T>(0.004) * cos_d(J8)),
+					static_cast<T>(259.51) + (static_cast<T>(21.5710715) * d)
+						+ (static_cast<T>(0.061) * sin_d(J5)) - (static_cast<T>(0.533) * sin_d(J6)) - (static_cast<T>(0.009) * sin_d(J8))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Mimas(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T S3 = static_cast<T>(177.40) - (static_cast<T>(36505.5) * _t),
+				        S5 = static_cast<T>(316.45) + (static_cast<T>(  506.2) * _t);
+				
+				return {
+					static_cast<T>(40.66) - (static_cast<T>(0.036) * _t) + (static_cast<T>(13.56) * sin_d(S3)),
+					static_cast<T>(83.52) - (static_cast<T>(0.004) * _t) - (static_cast<T>( 1.53) * cos_d(S3)),
+					static_cast<T>(333.46) + (static_cast<T>(381.9945550) * d) - (static_cast<T>(13.48) * sin_d(S3)) - (static_cast<T>(44.85) * sin_d(S5))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Enceladus(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(40.66) - (static_cast<T>(0.036) * _t),
+					static_cast<T>(83.52) - (static_cast<T>(0.004) * _t),
+					static_cast<T>(6.32) + (static_cast<T>(262.7318996) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Tethys(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T S4 = static_cast<T>(300.00) - (static_cast<T>(7225.9) * _t),
+				        S5 = static_cast<T>(316.45) + (static_cast<T>( 506.2) * _t);
+				
+				return {
+					static_cast<T>(40.66) - (static_cast<T>(0.036) * _t) + (static_cast<T>(9.66) * sin_d(S4)),
+					static_cast<T>(83.52) - (static_cast<T>(0.004) * _t) - (static_cast<T>(1.09) * cos_d(S4)),
+					static_cast<T>(8.95) + (static_cast<T>(190.6979085) * d) - (static_cast<T>(9.60) * sin_d(S4)) + (static_cast<T>(2.23) * sin_d(S5))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Dione(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(40.66) - (static_cast<T>(0.036) * _t),
+					static_cast<T>(83.52) - (static_cast<T>(0.004) * _t),
+					static_cast<T>(357.6) + (static_cast<T>(131.5349316) * d)
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Rhea(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				const T S6 = static_cast<T>(345.20) - (static_cast<T>(1016.3) * _t);
+				
+				return {
+					static_cast<T>(40.38) - (static_cast<T>(0.036) * _t) + (static_cast<T>(3.10) * sin_d(S6)),
+					static_cast<T>(83.55) - (static_cast<T>(0.004) * _t) - (static_cast<T>(0.35) * cos_d(S6)),
+					static_cast<T>(235.16) + (static_cast<T>(79.6900478) * d) - (static_cast<T>(3.08) * sin_d(S6))
+				};
+			}
+			
+			template<typename T>
+			static std::array<T, 3U> Titan(const T& _t) {
+				
+				const T d = _t * static_cast<T>(365250.0);
+				
+				return {
+					static_cast<T>(39.4827),
+					static_cast<T>(83.4279),
+					static_cast<T>(186.5855) + (static_cast<T>(22.5769768) * d)
+				};
+			}
+		};
+		
+		/**
+		 * @brief Returns the orientation of a body by name, from the report WGCCRE selects by default.
+		 *
+		 * @param[in] _name The name of the body.
+		 * @param[in] _t The epoch.
+		 * @return The orientation as alpha, delta and W (degrees), or an empty optional for an unknown name.
+		 */
+		template<typename T>
+		static std::optional<std::array<T, 3U>> GetOrientation(const std::string_view& _name, const T& _t) {
+			
+			std::optional<std::array<T, 3U>> result;
+			
+			     if (_name == "Sol"      ) { result = Report_2015::Sol      (_t); }
+			else if (_name == "Mercury"  ) { result = Report_2015::Mercury  (_t); }
+			else if (_name == "Venus"    ) { result = Report_2015::Venus    (_t); }
+			else if (_name == "Earth"    ) { result = Report_2009::Earth    (_t); }
+			else if (_name == "Moon"     ) { result = Report_2009::Moon     (_t); }
+			else if (_name == "Mars"     ) { result = Report_2015::Mars     (_t); }
+			else if (_name == "Jupiter"  ) { result = Report_2015::Jupiter  (_t); }
+			else if (_name == "Saturn"   ) { result = Report_2015::Saturn   (_t); }
+			else if (_name == "Uranus"   ) { result = Report_2015::Uranus   (_t); }
+			else if (_name == "Neptune"  ) { result = Report_2015::Neptune  (_t); }
+			else if (_name == "Phobos"   ) { result = Report_2009::Phobos   (_t); }
+			else if (_name == "Deimos"   ) { result = Report_2009::Deimos   (_t); }
+			else if (_name == "Io"       ) { result = Report_2009::Io       (_t); }
+			else if (_name == "Europa"   ) { result = Report_2009::Europa   (_t); }
+			else if (_name == "Ganymede" ) { result = Report_2009::Ganymede (_t); }
+			else if (_name == "Callisto" ) { result = Report_2009::Callisto (_t); }
+			else if (_name == "Mimas"    ) { result = Report_2009::Mimas    (_t); }
+			else if (_name == "Enceladus") { result = Report_2009::Enceladus(_t); }
+			else if (_name == "Tethys"   ) { result = Report_2009::Tethys   (_t); }
+			else if (_name == "Dione"    ) { result = Report_2009::Dione    (_t); }
+			else if (_name == "Rhea"     ) { result = Report_2009::Rhea     (_t); }
+			else if (_name == "Titan"    ) { result = Report_2009::Titan    (_t); }
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Converts an orientation into the VSOP87 frame, as in the original WGCCRE::ToVSOP87().
+		 *
+		 * @param[in] _alpha_delta_W The orientation as alpha, delta and W (degrees).
+		 * @return The orientation in the VSOP87 frame, in [0, 360).
+		 */
+		template<typename T>
+		static std::array<T, 3U> ToVSOP87(const std::array<T, 3U>& _alpha_delta_W) {
+			
+			// Values courtesy of stellarium: https://github.com/Stellarium/stellarium/blob/e57820ca6122fe4353d4d66dfa1104bd60e4deb5/src/core/StelCore.cpp#L59
+			const T x_offset = static_cast<T>(90.0) - static_cast<T>(23.4392803055555555556L);
+			const T y_offset = static_cast<T>(0.0000275);
+			
+			const auto wrap = [](const T& _x) {
+				const T result = std::fmod(_x, static_cast<T>(360.0));
+				return result < static_cast<T>(0.0) ? result + static_cast<T>(360.0) : result;
+			};
+			
+			return {
+				wrap(_alpha_delta_W[1] + x_offset),
+				wrap((_alpha_delta_W[0] + _alpha_delta_W[2]) - static_cast<T>(180.0) + y_offset),
+				static_cast<T>(0.0)
+			};
+		}
+	};
+
+} // LouiEriksson::Test
+
+#endif //LOUIERIKSSON_WGCCRE_TESTS_REFERENCE_HPP
@@ -0,0 +1,120 @@
+/**
+ * @file Table.cpp
+ * @brief Checks that tables written by TableWriter read back through TableReader as Reference describes them.
+ */
+
+#include "Reference.hpp"
+#include "Test.hpp"
+
+#include <cstdio>
+
+namespace {
+	
+	using LouiEriksson::WGCCRE;
+	using LouiEriksson::Test::AngularDistance;
+	using LouiEriksson::Test::Reference;
+	
+	/**
+	 * @brief Writes a table of every body in \p T, then checks its header, records and interpolation.
+	 *
+	 * @param[in] _path The file to write, which is removed afterwards.
+	 * @param[in] _begin The epoch of the first record.
+	 * @param[in] _tolerance The largest acceptable error of a record (degrees).
+	 */
+	template<typename T>
+	void CheckRoundTrip(const char* _path, const double& _begin, const long double& _tolerance) {
+		
+		LouiEriksson::Test::ForEachBody([&](auto _b) {
+			
+			constexpr auto body = decltype(_b)::value;
+			
+			// Ten-minute records. The table is appended in two parts, so that the second continues from the first.
+			const double step = 1.0 / (144.0 * 365250.0);
+			
+			const std::size_t count = 1000U;
+			
+			{
+				WGCCRE::TableWriter<T> writer(_path, body, _begin, step);
+				
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Good());
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Append(count - 1U - 300U));
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Append(300U));
+				
+				// One record appended directly, as the evaluators would have written it.
+				const auto last = WGCCRE::GetOrientation<body>(LouiEriksson::Test::Split<double>(_begin + (static_cast<double>(count - 1U) * step)));
+				
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Append(std::array<T, 3U> { static_cast<T>(last[0]), static_cast<T>(last[1]), static_cast<T>(last[2]) }));
+				LOUIERIKSSON_WGCCRE_CHECK(writer.Close());
+			}
+			
+			const WGCCRE::TableReader<T> reader(_path);
+			
+			if (!LOUIERIKSSON_WGCCRE_CHECK(reader.Good())) {
+				return;
+			}
+			
+			const auto& header = reader.Header();
+			
+			LOUIERIKSSON_WGCCRE_CHECK(reader.GetBody() == body);
+			LOUIERIKSSON_WGCCRE_CHECK(reader.Count() == count);
+			LOUIERIKSSON_WGCCRE_CHECK(header.version == WGCCRE::TableHeader::s_Version);
+			LOUIERIKSSON_WGCCRE_CHECK(header.begin == _begin && header.step == step);
+			
+			const auto expected = [&](const long double& _t) {
+				return *Reference::GetOrientation(WGCCRE::GetName(body), _t);
+			};
+			
+			bool records = true, interpolated = true;
+			for (std::size_t i = 0U; i < count; ++i) {
+				
+				const long double t = static_cast<long double>(_begin) + (static_cast<long double>(i) * static_cast<long double>(step));
+				
+				const auto record = reader.At(i);
+				
+				records = records && AngularDistance(record, expected(t)) <= _tolerance && record[2] >= 0 && record[2] < 360;
+				
+				// Between records the table interpolates linearly, so the midpoint of an interval is the mean of its ends.
+				if (i + 1U < count) {
+					
+					const auto begin = expected(t);
+					const auto end   = expected(t + static_cast<long double>(step));
+					
+					std::array<long double, 3U> mean{};
+					for (std::size_t j = 0U; j < 3U; ++j) {
+						mean[j] = begin[j] + (0.5L * (std::remainder(end[j] - begin[j], 360.0L)));
+					}
+					
+					const double midpoint = static_cast<double>(t + (0.5L * static_cast<long double>(step)));
+					
+					interpolated = interpolated && AngularDistance(reader.Get(midpoint), mean) <= _tolerance;
+				}
+			}
+			
+			LOUIERIKSSON_WGCCRE_CHECK(records);
+			LOUIERIKSSON_WGCCRE_CHECK(interpolated);
+			
+			// Tables are only read in the precision they were written in.
+			if constexpr (std::is_same_v<T, float>) {
+				LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::TableReader<double>(_path).Good());
+			}
+			else {
+				LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::TableReader<float>(_path).Good());
+			}
+		});
+		
+		std::remove(_path);
+		
+		LOUIERIKSSON_WGCCRE_CHECK(!WGCCRE::TableReader<T>(_path).Good());
+	}
+
+} // namespace
+
+int main() {
+	
+	// Float tables store W reduced, so keep their resolution however far from J2000.0 they begin.
+	CheckRoundTrip<float> ("Table_float.tbl",  -2.7, 1.0e-4L);
+	CheckRoundTrip<float> ("Table_float.tbl",   0.0, 1.0e-4L);
+	CheckRoundTrip<double>("Table_double.tbl",  0.1, 1.0e-7L);
+	
+	return LouiEriksson::Test::Summarise("Table");
+}
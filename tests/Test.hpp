@@ -0,0 +1,131 @@
+#ifndef LOUIERIKSSON_WGCCRE_TESTS_TEST_HPP
+#define LOUIERIKSSON_WGCCRE_TESTS_TEST_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+#include "WGCCRE.hpp"
+
+/**
+ * @brief Records a failure, with its location, if a condition does not hold. The test continues either way.
+ */
+#define LOUIERIKSSON_WGCCRE_CHECK(condition) ::LouiEriksson::Test::Check((condition), #condition, __FILE__, __LINE__)
+
+namespace LouiEriksson::Test {
+	
+	/**
+	 * @brief Returns the number of failed checks so far.
+	 */
+	inline std::size_t& Failures() {
+		
+		static std::size_t s_Failures = 0U;
+		
+		return s_Failures;
+	}
+	
+	/**
+	 * @brief Records a failure if a condition does not hold.
+	 *
+	 * @param[in] _condition The condition.
+	 * @param[in] _expression The text of the condition.
+	 * @param[in] _file The file containing the check.
+	 * @param[in] _line The line of the check.
+	 * @return The condition.
+	 */
+	inline bool Check(const bool& _condition, const char* _expression, const char* _file, const int& _line) {
+		
+		if (!_condition) {
+			
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", _file, _line, _expression);
+			
+			++Failures();
+		}
+		
+		return _condition;
+	}
+	
+	/**
+	 * @brief Returns the exit status of a test, printing a summary.
+	 *
+	 * @param[in] _name The name of the test.
+	 * @return Zero if every check passed.
+	 */
+	inline int Summarise(const char* _name) {
+		
+		if (Failures() == 0U) {
+			std::printf("%s: passed\n", _name);
+		}
+		else {
+			std::printf("%s: %zu check(s) failed\n", _name, Failures());
+		}
+		
+		return Failures() == 0U ? 0 : 1;
+	}
+	
+	/**
+	 * @brief Returns the absolute difference between two angles in degrees, allowing for wrapping.
+	 *
+	 * @details Computed in long double, so that the difference of two large unreduced values of W is exact enough
+	 * for the tolerances of the tests.
+	 */
+	template<typename A, typename B>
+	long double AngularDistance(const A& _a, const B& _b) {
+		
+		const long double d = std::fmod(std::fabs(static_cast<long double>(_a) - static_cast<long double>(_b)), 360.0L);
+		
+		return std::min(d, 360.0L - d);
+	}
+	
+	/**
+	 * @brief Returns the largest AngularDistance() between the components of two orientations.
+	 */
+	template<typename A, typename B>
+	long double AngularDistance(const std::array<A, 3U>& _a, const std::array<B, 3U>& _b) {
+		
+		long double result = 0.0L;
+		
+		for (std::size_t i = 0U; i < 3U; ++i) {
+			result = std::max(result, AngularDistance(_a[i], _b[i]));
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Invokes a function once per Body, passing it as a std::integral_constant.
+	 */
+	template<typename F, std::size_t... I>
+	void ForEachBody(const F& _f, std::index_sequence<I...>) {
+		(_f(std::integral_constant<WGCCRE::Body, static_cast<WGCCRE::Body>(I)>{}), ...);
+	}
+	
+	/**
+	 * @brief Invokes a function once per Body, passing it as a std::integral_constant.
+	 */
+	template<typename F>
+	void ForEachBody(const F& _f) {
+		ForEachBody(_f, std::make_index_sequence<WGCCRE::s_BodyCount>{});
+	}
+	
+	/**
+	 * @brief Returns an epoch as a split epoch of whole days and a fraction of a day.
+	 *
+	 * @param[in] _t The epoch, in Julian millennia since J2000.0.
+	 */
+	template<typename T>
+	WGCCRE::SplitEpoch<T> Split(const long double& _t) {
+		
+		const long double days  = _t * 365250.0L;
+		const long double whole = std::floor(days);
+		
+		return { static_cast<T>(whole), static_cast<T>(days - whole) };
+	}
+
+} // LouiEriksson::Test
+
+#endif //LOUIERIKSSON_WGCCRE_TESTS_TEST_HPP